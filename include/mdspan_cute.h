@@ -9,8 +9,60 @@
 // Or individually:
 //   #include <mdspan_cute/cuda_gcc15_compat.h>
 //   #include <mdspan_cute/layout_cute.h>
+//   #include <mdspan_cute/index_space.h>
+//   #include <mdspan_cute/tile_iteration.h>
+//   #include <mdspan_cute/static_loop.h>
+//   #include <mdspan_cute/loop_order.h>
+//   #include <mdspan_cute/parallel.h>
+//   #include <mdspan_cute/reduce.h>
+//   #include <mdspan_cute/transform.h>
+//   #include <mdspan_cute/storage_order.h>
+//   #include <mdspan_cute/relayout.h>
+//   #include <mdspan_cute/permute.h>
+//   #include <mdspan_cute/tv_parallel.h>
+//   #include <mdspan_cute/tile_scheduler.h>
+//   #include <mdspan_cute/arena.h>
+//   #include <mdspan_cute/mdarray.h>
+//   #include <mdspan_cute/broadcast.h>
+//   #include <mdspan_cute/curve_layouts.h>
+//   #include <mdspan_cute/paged_layout.h>
+//   #include <mdspan_cute/ring_layout.h>
+//   #include <mdspan_cute/ragged_layout.h>
+//   #include <mdspan_cute/batched.h>
+//   #include <mdspan_cute/packing.h>
+//   #include <mdspan_cute/vector_access.h>
+//   #include <mdspan_cute/convert.h>
+//   #include <mdspan_cute/gather.h>
+//   #include <mdspan_cute/compressed.h>
+//   #include <mdspan_cute/tile_cache.h>
 
 #pragma once
 
 #include <mdspan_cute/cuda_gcc15_compat.h>
 #include <mdspan_cute/layout_cute.h>
+#include <mdspan_cute/index_space.h>
+#include <mdspan_cute/tile_iteration.h>
+#include <mdspan_cute/static_loop.h>
+#include <mdspan_cute/loop_order.h>
+#include <mdspan_cute/parallel.h>
+#include <mdspan_cute/reduce.h>
+#include <mdspan_cute/transform.h>
+#include <mdspan_cute/storage_order.h>
+#include <mdspan_cute/relayout.h>
+#include <mdspan_cute/permute.h>
+#include <mdspan_cute/tv_parallel.h>
+#include <mdspan_cute/tile_scheduler.h>
+#include <mdspan_cute/arena.h>
+#include <mdspan_cute/mdarray.h>
+#include <mdspan_cute/broadcast.h>
+#include <mdspan_cute/curve_layouts.h>
+#include <mdspan_cute/paged_layout.h>
+#include <mdspan_cute/ring_layout.h>
+#include <mdspan_cute/ragged_layout.h>
+#include <mdspan_cute/batched.h>
+#include <mdspan_cute/packing.h>
+#include <mdspan_cute/vector_access.h>
+#include <mdspan_cute/convert.h>
+#include <mdspan_cute/gather.h>
+#include <mdspan_cute/compressed.h>
+#include <mdspan_cute/tile_cache.h>
@@ -0,0 +1,263 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// Copyright 2026 Weyl AI
+//
+// mdspan_cute/arena.h
+//
+// Layout-sized scratch allocation from a per-thread bump arena.
+//
+//   {
+//     mdspan_cute::arena_scope scope; // rewinds the thread arena on exit
+//     auto tile = mdspan_cute::allocate_for<float>(
+//         swizzle::make_swizzled_layout<swizzle::sw128>(shape, stride));
+//     tile[r, c] = ...;              // layout_cute mdspan, cosize elements
+//   }
+//
+// Per-request staging tiles allocated with std::vector go through malloc
+// every time; under load that is lock contention and page faults. The
+// arena hands out memory by bumping a pointer inside large chunks and frees
+// it all at once (reset / rewind), so the steady state does no system
+// allocation at all.
+//
+// allocate_for<T>(layout) returns exactly cosize(layout) elements, aligned to
+// the largest of alignof(T), the vector width (64 bytes) and the layout's
+// swizzle period 2^(B+M+|S|)·sizeof(T) (capped at one page), so the bank/XOR
+// pattern of a swizzled tile starts on a period boundary. Chunks of at least
+// huge_page_threshold bytes are mmap'd and advised MADV_HUGEPAGE on Linux.
+//
+// Memory is uninitialized and never destroyed, so T must be trivially
+// default-constructible and trivially destructible.
+
+#pragma once
+
+#include <mdspan_cute/layout_cute.h>
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+#include <cute/layout.hpp>
+#include <cute/swizzle.hpp>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace mdspan_cute {
+
+inline constexpr std::size_t arena_vector_alignment = 64;
+inline constexpr std::size_t arena_page_size = 4096;
+inline constexpr std::size_t arena_chunk_bytes = std::size_t{1} << 20;
+inline constexpr std::size_t huge_page_threshold = std::size_t{2} << 20;
+
+// ═══════════════════════════════════════════════════════════════════════════════
+namespace detail {
+
+// Elements after which a swizzle's XOR pattern repeats (1 when unswizzled)
+template <class L>
+struct swizzle_period : std::integral_constant<std::size_t, 1> {};
+
+template <int B, int M, int S, class Offset, class Inner>
+struct swizzle_period<
+    cute::ComposedLayout<cute::Swizzle<B, M, S>, Offset, Inner>>
+    : std::integral_constant<std::size_t,
+                             std::size_t{1} << (B + M + (S < 0 ? -S : S))> {};
+
+constexpr auto align_up(std::uintptr_t v, std::size_t a) noexcept
+    -> std::uintptr_t {
+  return (v + a - 1) & ~static_cast<std::uintptr_t>(a - 1);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Chunk memory: page-aligned operator new, or huge-page mmap when large
+// ─────────────────────────────────────────────────────────────────────────────
+
+struct arena_block {
+  std::byte *data = nullptr;
+  std::size_t bytes = 0;
+  void *mapping = nullptr; // non-null when mmap'd
+  std::size_t mapped_bytes = 0;
+};
+
+inline auto allocate_block(std::size_t bytes) -> arena_block {
+#if defined(__linux__)
+  if (bytes >= huge_page_threshold) {
+    // Over-map by one huge page so the chunk can start on a 2 MiB boundary
+    std::size_t const len = align_up(bytes, huge_page_threshold);
+    std::size_t const mapped = len + huge_page_threshold;
+    void *m = ::mmap(nullptr, mapped, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (m == MAP_FAILED)
+      throw std::bad_alloc();
+    auto *base = reinterpret_cast<std::byte *>(
+        align_up(reinterpret_cast<std::uintptr_t>(m), huge_page_threshold));
+#if defined(MADV_HUGEPAGE)
+    ::madvise(base, len, MADV_HUGEPAGE);
+#endif
+    return {base, len, m, mapped};
+  }
+#endif
+  auto *p = static_cast<std::byte *>(
+      ::operator new(bytes, std::align_val_t{arena_page_size}));
+  return {p, bytes, nullptr, 0};
+}
+
+inline void free_block(arena_block const &b) noexcept {
+#if defined(__linux__)
+  if (b.mapping) {
+    ::munmap(b.mapping, b.mapped_bytes);
+    return;
+  }
+#endif
+  ::operator delete(b.data, std::align_val_t{arena_page_size});
+}
+
+} // namespace detail
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Alignment for a tile of T laid out by `layout`
+// ═══════════════════════════════════════════════════════════════════════════════
+
+template <class T, class CuteLayout>
+[[nodiscard]] constexpr auto layout_alignment(CuteLayout const & = {}) noexcept
+    -> std::size_t {
+  std::size_t const a = std::max(alignof(T), arena_vector_alignment);
+  std::size_t const period =
+      std::bit_ceil(detail::swizzle_period<CuteLayout>::value * sizeof(T));
+  return std::max(a, std::min(period, arena_page_size));
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// bump_arena: chunked bump allocator with bulk reset
+// Chunks are kept across reset()/rewind() and reused; release() frees them.
+// Not thread-safe: use one arena per thread (thread_arena()).
+// ═══════════════════════════════════════════════════════════════════════════════
+
+class bump_arena {
+public:
+  // Position to rewind to (see arena_scope)
+  struct marker {
+    std::size_t chunk = 0;
+    std::size_t offset = 0;
+  };
+
+  explicit bump_arena(std::size_t chunk_bytes = arena_chunk_bytes) noexcept
+      : chunk_bytes_(chunk_bytes) {}
+
+  bump_arena(bump_arena const &) = delete;
+  auto operator=(bump_arena const &) -> bump_arena & = delete;
+
+  ~bump_arena() { release(); }
+
+  [[nodiscard]] auto allocate(std::size_t bytes, std::size_t align)
+      -> void * {
+    if (auto *p = try_bump(bytes, align))
+      return p;
+    // Later chunks kept from before a reset may still fit
+    while (current_ + 1 < chunks_.size()) {
+      ++current_;
+      offset_ = 0;
+      if (auto *p = try_bump(bytes, align))
+        return p;
+    }
+    chunks_.push_back(
+        detail::allocate_block(std::max(chunk_bytes_, bytes + align)));
+    current_ = chunks_.size() - 1;
+    offset_ = 0;
+    return try_bump(bytes, align);
+  }
+
+  [[nodiscard]] auto mark() const noexcept -> marker {
+    return {current_, offset_};
+  }
+
+  void rewind(marker m) noexcept {
+    current_ = m.chunk;
+    offset_ = m.offset;
+  }
+
+  void reset() noexcept { rewind({}); }
+
+  void release() noexcept {
+    for (auto const &b : chunks_)
+      detail::free_block(b);
+    chunks_.clear();
+    reset();
+  }
+
+  // Bytes handed out since the last reset (including alignment padding and
+  // the unused tails of skipped chunks)
+  [[nodiscard]] auto bytes_in_use() const noexcept -> std::size_t {
+    std::size_t n = offset_;
+    for (std::size_t i = 0; i < current_ && i < chunks_.size(); ++i)
+      n += chunks_[i].bytes;
+    return n;
+  }
+
+  [[nodiscard]] auto capacity() const noexcept -> std::size_t {
+    std::size_t n = 0;
+    for (auto const &b : chunks_)
+      n += b.bytes;
+    return n;
+  }
+
+private:
+  auto try_bump(std::size_t bytes, std::size_t align) noexcept -> void * {
+    if (current_ >= chunks_.size())
+      return nullptr;
+    auto const &c = chunks_[current_];
+    auto const base = reinterpret_cast<std::uintptr_t>(c.data);
+    auto const start = detail::align_up(base + offset_, align) - base;
+    if (start + bytes > c.bytes)
+      return nullptr;
+    offset_ = start + bytes;
+    return c.data + start;
+  }
+
+  std::vector<detail::arena_block> chunks_;
+  std::size_t current_ = 0;
+  std::size_t offset_ = 0;
+  std::size_t chunk_bytes_;
+};
+
+// The calling thread's arena
+[[nodiscard]] inline auto thread_arena() -> bump_arena & {
+  thread_local bump_arena arena;
+  return arena;
+}
+
+// Rewinds an arena to where it was when the scope was entered
+class arena_scope {
+public:
+  explicit arena_scope(bump_arena &arena = thread_arena()) noexcept
+      : arena_(arena), mark_(arena.mark()) {}
+  arena_scope(arena_scope const &) = delete;
+  auto operator=(arena_scope const &) -> arena_scope & = delete;
+  ~arena_scope() { arena_.rewind(mark_); }
+
+private:
+  bump_arena &arena_;
+  bump_arena::marker mark_;
+};
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// allocate_for<T>(layout[, arena]): cosize(layout) elements as a layout_cute
+// mdspan. Valid until the arena is rewound past this allocation.
+// ═══════════════════════════════════════════════════════════════════════════════
+
+template <class T, cute_layout CuteLayout>
+[[nodiscard]] auto allocate_for(CuteLayout const &layout,
+                                bump_arena &arena = thread_arena()) {
+  static_assert(std::is_trivially_default_constructible_v<T> &&
+                    std::is_trivially_destructible_v<T>,
+                "mdspan_cute::allocate_for: arena memory is uninitialized "
+                "and never destroyed");
+  auto const n = static_cast<std::size_t>(cute::cosize(layout));
+  void *p = arena.allocate(n * sizeof(T), layout_alignment<T>(layout));
+  return make_mdspan(static_cast<T *>(p), layout);
+}
+
+} // namespace mdspan_cute
@@ -0,0 +1,257 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// Copyright 2026 Weyl AI
+//
+// mdspan_cute/batched.h
+//
+// Strided batches of small tiles and a batch-parallel elementwise engine.
+//
+//   auto tile = cute::make_layout(cute::make_shape(cute::Int<4>{},
+//                                                  cute::Int<4>{}),
+//                                 cute::LayoutRight{});
+//
+//   // x[i, j, b]: element (i, j) of tile b; tiles stored one after another
+//   auto x = mdspan_cute::make_batched_mdspan(px, tile, n);
+//
+//   // Interleaved ("SoA of tiles"): element (i, j) of all n tiles is
+//   // contiguous, so the batch mode has unit stride
+//   auto y = mdspan_cute::make_batched_mdspan<
+//       mdspan_cute::batch_order::interleaved>(py, tile, n);
+//
+//   mdspan_cute::batch_transform(y, [](float a, float b) { return a * b; },
+//                                y, x);    // y[i, j, b] = f(y, x)[i, j, b]
+//
+// The batched layout is cute's make_layout concatenation of the tile layout
+// and a (n):(stride) batch mode, flattened so that mdspan coordinates are
+// (tile modes..., batch). Tile-major uses stride cosize(tile) and keeps each
+// tile contiguous; interleaved scales every tile stride by n and gives the
+// batch stride 1. Swizzled tiles are batched tile-major by extending the
+// swizzle's inner layout; the tile cosize must be a multiple of the swizzle
+// period so that every tile is swizzled identically.
+//
+// batch_transform loops the tile coordinates outermost and the batch
+// innermost, whatever the strides, and splits the batch across threads. With
+// interleaved operands the inner loop is a unit-stride pointer loop the
+// compiler vectorizes across tiles; per-tile loops over a 4×4 tile cannot
+// fill SIMD lanes. For tile-major operands, transform (transform.h) orders
+// the loops by stride instead. The batch step is measured once and reused for
+// every tile only when all operands are affine; otherwise (swizzles, whose
+// batch step can differ per tile) each element goes through its mapping.
+
+#pragma once
+
+#include <mdspan_cute/index_space.h>
+#include <mdspan_cute/layout_cute.h>
+#include <mdspan_cute/loop_order.h>
+#include <mdspan_cute/parallel.h>
+#include <mdspan_cute/transform.h>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <cute/layout.hpp>
+#include <cute/swizzle.hpp>
+
+namespace mdspan_cute {
+
+// Placement of the batch mode relative to the tile modes
+enum class batch_order {
+  tile_major,  // tile b occupies [b · cosize(tile), (b + 1) · cosize(tile))
+  interleaved, // element c of tile b at tile(c) · n + b
+};
+
+// ═══════════════════════════════════════════════════════════════════════════════
+namespace detail {
+
+// (tile modes..., n):(tile strides..., s)
+template <class Shape, class Stride, class N, class S>
+[[nodiscard]] constexpr auto
+append_batch_mode(cute::Layout<Shape, Stride> const &tile, N const &n,
+                  S const &s) {
+  return cute::flatten(cute::make_layout(tile, cute::make_layout(n, s)));
+}
+
+template <batch_order Order, class Shape, class Stride, class N>
+[[nodiscard]] constexpr auto
+batched_layout(cute::Layout<Shape, Stride> const &tile, N const &n) {
+  if constexpr (Order == batch_order::tile_major) {
+    return append_batch_mode(tile, n, cute::cosize(tile));
+  } else {
+    auto const flat = cute::flatten(tile);
+    auto const scaled = cute::make_layout(
+        cute::shape(flat),
+        cute::transform(cute::stride(flat),
+                        [&](auto const &s) { return s * n; }));
+    return append_batch_mode(scaled, n, cute::Int<1>{});
+  }
+}
+
+template <batch_order Order, int B, int M, int S, class Offset, class Inner,
+          class N>
+[[nodiscard]] constexpr auto batched_layout(
+    cute::ComposedLayout<cute::Swizzle<B, M, S>, Offset, Inner> const &tile,
+    N const &n) {
+  static_assert(Order == batch_order::tile_major,
+                "mdspan_cute::make_batched_layout: swizzled tiles can only be "
+                "batched tile-major");
+  constexpr std::int64_t period = std::int64_t{1}
+                                  << (B + M + (S < 0 ? -S : S));
+  assert(static_cast<std::int64_t>(cute::cosize(tile.layout_b())) % period ==
+             0 &&
+         "mdspan_cute::make_batched_layout: tile cosize must be a multiple "
+         "of the swizzle period");
+  return cute::composition(tile.layout_a(), tile.offset(),
+                           batched_layout<Order>(tile.layout_b(), n));
+}
+
+} // namespace detail
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// make_batched_layout<Order>(tile, n): shape (tile modes..., n)
+// make_batched_mdspan<Order>(ptr, tile, n)
+// ═══════════════════════════════════════════════════════════════════════════════
+
+template <batch_order Order = batch_order::tile_major, class Tile, class N>
+  requires cute_layout<Tile>
+[[nodiscard]] constexpr auto make_batched_layout(Tile const &tile,
+                                                 N const &n) {
+  return detail::batched_layout<Order>(tile, n);
+}
+
+template <batch_order Order = batch_order::tile_major, class T, class Tile,
+          class N>
+  requires cute_layout<Tile>
+[[nodiscard]] constexpr auto make_batched_mdspan(T *ptr, Tile const &tile,
+                                                 N const &n) {
+  return make_mdspan(ptr, make_batched_layout<Order>(tile, n));
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+namespace detail {
+
+// Batch elements per scheduling block (keeps thread boundaries SIMD aligned)
+inline constexpr std::size_t batch_block = 64;
+
+template <class Out, class F, class... Ins>
+void batch_transform_impl(std::size_t num_threads, Out const &out, F &f,
+                          Ins const &...ins) {
+  constexpr std::size_t R = Out::rank();
+  constexpr std::size_t N = 1 + sizeof...(Ins);
+  static_assert(R >= 1,
+                "mdspan_cute::batch_transform: operands need a batch mode");
+  static_assert(((Ins::rank() == R) && ...),
+                "mdspan_cute::batch_transform: operand ranks differ");
+  using coord_type = index_array<typename Out::extents_type>;
+  using offsets_type = std::array<std::ptrdiff_t, N>;
+
+  auto const exts = extents_array(out.extents());
+  for (std::size_t k = 0; k < R; ++k)
+    assert(((static_cast<std::size_t>(ins.extent(k)) ==
+             static_cast<std::size_t>(exts[k])) &&
+            ...));
+  if (out.size() == 0)
+    return;
+
+  std::tuple<Ins const &...> const in_t{ins...};
+  auto offsets = [&](coord_type const &c) {
+    return offsets_type{
+        static_cast<std::ptrdiff_t>(offset_at(out.mapping(), c)),
+        static_cast<std::ptrdiff_t>(offset_at(ins.mapping(), c))...};
+  };
+  auto apply = [&]<std::size_t... Is>(std::index_sequence<Is...>,
+                                      offsets_type const &o) {
+    out.accessor().access(out.data_handle(), static_cast<std::size_t>(o[0])) =
+        f(std::get<Is>(in_t).accessor().access(
+            std::get<Is>(in_t).data_handle(),
+            static_cast<std::size_t>(o[Is + 1]))...);
+  };
+  auto const in_seq = std::index_sequence_for<Ins...>{};
+
+  // Affine operands step the batch by a constant, measured at tile 0
+  auto const batch = static_cast<std::size_t>(exts[R - 1]);
+  bool const affine = affine_strides(out.mapping()).has_value() &&
+                      (affine_strides(ins.mapping()).has_value() && ...);
+  offsets_type step{};
+  bool unit = true;
+  if (affine && batch > 1) {
+    coord_type one{};
+    one[R - 1] = 1;
+    auto const o0 = offsets(coord_type{}), o1 = offsets(one);
+    for (std::size_t op = 0; op < N; ++op) {
+      step[op] = o1[op] - o0[op];
+      unit = unit && step[op] == 1;
+    }
+  }
+
+  // Batch elements [b, e) of every tile: tile coordinates outer, batch inner
+  auto run = [&](std::size_t b, std::size_t e) {
+    coord_type lo{}, hi = exts, c{};
+    hi[R - 1] = 1;
+    auto body = [&](coord_type const &tc) {
+      if (!affine) {
+        auto bc = tc;
+        for (std::size_t i = b; i < e; ++i) {
+          bc[R - 1] = static_cast<typename coord_type::value_type>(i);
+          apply(in_seq, offsets(bc));
+        }
+        return;
+      }
+      auto base = offsets(tc);
+      for (std::size_t op = 0; op < N; ++op)
+        base[op] += std::ptrdiff_t(b) * step[op];
+      if (unit) {
+        for (std::size_t i = 0; i < e - b; ++i) {
+          offsets_type o;
+          for (std::size_t op = 0; op < N; ++op)
+            o[op] = base[op] + std::ptrdiff_t(i);
+          apply(in_seq, o);
+        }
+      } else {
+        for (std::size_t i = 0; i < e - b; ++i) {
+          offsets_type o;
+          for (std::size_t op = 0; op < N; ++op)
+            o[op] = base[op] + std::ptrdiff_t(i) * step[op];
+          apply(in_seq, o);
+        }
+      }
+    };
+    for_each_in_box(lo, hi, c, body);
+  };
+
+  std::size_t const blocks = (batch + batch_block - 1) / batch_block;
+  parallel_for_chunks(blocks, threads_for(out.size(), num_threads),
+                      [&](std::size_t b, std::size_t e) {
+                        run(b * batch_block,
+                            std::min(batch, e * batch_block));
+                      });
+}
+
+} // namespace detail
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// batch_transform([num_threads,] out, f, ins...)
+// out[c..., b] = f(ins[c..., b]...); the last mode is the batch
+// ═══════════════════════════════════════════════════════════════════════════════
+
+template <class TO, class EO, class LO, class AO, class F,
+          detail::any_mdspan... Ins>
+  requires std::invocable<F &, typename Ins::reference...>
+void batch_transform(std::size_t num_threads, std::mdspan<TO, EO, LO, AO> out,
+                     F f, Ins... ins) {
+  detail::batch_transform_impl(num_threads, out, f, ins...);
+}
+
+template <class TO, class EO, class LO, class AO, class F,
+          detail::any_mdspan... Ins>
+  requires std::invocable<F &, typename Ins::reference...>
+void batch_transform(std::mdspan<TO, EO, LO, AO> out, F f, Ins... ins) {
+  detail::batch_transform_impl(default_num_threads(), out, f, ins...);
+}
+
+} // namespace mdspan_cute
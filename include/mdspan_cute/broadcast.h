@@ -0,0 +1,135 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// Copyright 2026 Weyl AI
+//
+// mdspan_cute/broadcast.h
+//
+// Zero-copy broadcast and sliding-window views (non-unique layouts).
+//
+//   // Bias of N elements seen as an M×N matrix: stride 0 along mode 0
+//   auto b = mdspan_cute::make_broadcast_mdspan<0>(
+//       bias, cute::make_shape(M, N));           // b[i, j] == bias[j]
+//
+//   // im2col without the copy: 3×3 windows over an H×W row-major image
+//   auto img = cute::make_layout(cute::make_shape(H, W),
+//                                cute::make_stride(W, 1));
+//   auto win = mdspan_cute::make_sliding_window_mdspan(
+//       x, img, std::array<std::size_t, 2>{3, 3});
+//   // win[oh, ow, kh, kw] == x[(oh + kh) * W + (ow + kw)]
+//
+// Both are ordinary layout_cute mdspans whose layouts map several indices
+// to one offset, so is_unique() reports false and writes through them alias.
+// Use them as read-only inputs (bias epilogues, implicit-GEMM convolution
+// operands) instead of materializing the expanded tensor.
+
+#pragma once
+
+#include <mdspan_cute/layout_cute.h>
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include <cute/layout.hpp>
+
+namespace mdspan_cute {
+
+// ═══════════════════════════════════════════════════════════════════════════════
+namespace detail {
+
+template <std::size_t K, std::size_t... Modes>
+inline constexpr bool is_broadcast_mode_v = ((K == Modes) || ...);
+
+template <std::size_t... Modes, class Shape, std::size_t... Ks>
+constexpr auto broadcast_layout(Shape const &shape,
+                                std::index_sequence<Ks...>) {
+  // The source is packed column-major over the non-broadcast modes
+  auto const packed = cute::make_shape([&] {
+    if constexpr (is_broadcast_mode_v<Ks, Modes...>)
+      return cute::Int<1>{};
+    else
+      return cute::get<Ks>(shape);
+  }()...);
+  auto const compact = cute::compact_col_major(packed);
+  auto const stride = cute::make_stride([&] {
+    if constexpr (is_broadcast_mode_v<Ks, Modes...>)
+      return cute::Int<0>{};
+    else
+      return cute::get<Ks>(compact);
+  }()...);
+  return cute::make_layout(shape, stride);
+}
+
+template <std::size_t R> constexpr auto ones() -> std::array<std::size_t, R> {
+  std::array<std::size_t, R> a{};
+  a.fill(1);
+  return a;
+}
+
+} // namespace detail
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// make_broadcast_mdspan<Modes...>(ptr, shape)
+// Modes listed in Modes get stride 0; the remaining modes index a compact
+// column-major source at ptr. Static shapes give a static layout.
+// ═══════════════════════════════════════════════════════════════════════════════
+
+template <std::size_t... Modes, class T, class Shape>
+[[nodiscard]] constexpr auto make_broadcast_mdspan(T *ptr,
+                                                   Shape const &shape) {
+  constexpr std::size_t R = cute::rank_v<Shape>;
+  static_assert(((Modes < R) && ...),
+                "mdspan_cute::make_broadcast_mdspan: mode out of range");
+  return make_mdspan(ptr, detail::broadcast_layout<Modes...>(
+                              shape, std::make_index_sequence<R>{}));
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// make_sliding_window_mdspan(ptr, base, window[, step, dilation])
+// Rank 2R view over a flat affine layout `base` of rank R:
+//   mode k      window position, extent (e_k − dil_k·(w_k − 1) − 1)/s_k + 1,
+//               stride s_k·d_k
+//   mode R + k  offset inside the window, extent w_k, stride dil_k·d_k
+// where e_k, d_k are the extent and stride of base's mode k. Windows overlap
+// whenever step < window, which makes the view non-unique.
+// ═══════════════════════════════════════════════════════════════════════════════
+
+template <class T, class Shape, class Stride, std::size_t R>
+[[nodiscard]] constexpr auto make_sliding_window_mdspan(
+    T *ptr, cute::Layout<Shape, Stride> const &base,
+    std::array<std::size_t, R> const &window,
+    std::array<std::size_t, R> const &step = detail::ones<R>(),
+    std::array<std::size_t, R> const &dilation = detail::ones<R>()) {
+  auto const shape = detail::flatten_shape(cute::shape(base));
+  auto const stride = detail::flatten_shape(cute::stride(base));
+  static_assert(detail::cute_layout_flat_rank_v<cute::Layout<Shape, Stride>> ==
+                    R,
+                "mdspan_cute::make_sliding_window_mdspan: window rank must "
+                "match the layout rank");
+
+  std::array<std::int64_t, R> pos{}, pos_stride{}, win_stride{};
+  [&]<std::size_t... Ks>(std::index_sequence<Ks...>) {
+    (([&] {
+       auto const e = detail::to_size_t(cute::get<Ks>(shape));
+       auto const d = static_cast<std::int64_t>(cute::get<Ks>(stride));
+       auto const reach = dilation[Ks] * (window[Ks] - 1) + 1;
+       assert(window[Ks] >= 1 && step[Ks] >= 1 && dilation[Ks] >= 1);
+       assert(reach <= e);
+       pos[Ks] = static_cast<std::int64_t>((e - reach) / step[Ks] + 1);
+       pos_stride[Ks] = static_cast<std::int64_t>(step[Ks]) * d;
+       win_stride[Ks] = static_cast<std::int64_t>(dilation[Ks]) * d;
+     }()),
+     ...);
+  }(std::make_index_sequence<R>{});
+
+  return [&]<std::size_t... Ks>(std::index_sequence<Ks...>) {
+    return make_mdspan(
+        ptr, cute::make_layout(
+                 cute::make_shape(pos[Ks]...,
+                                  static_cast<std::int64_t>(window[Ks])...),
+                 cute::make_stride(pos_stride[Ks]..., win_stride[Ks]...)));
+  }(std::make_index_sequence<R>{});
+}
+
+} // namespace mdspan_cute
@@ -0,0 +1,458 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// Copyright 2026 Weyl AI
+//
+// mdspan_cute/compressed.h
+//
+// Tile-granular compression for cold tensors.
+//
+//   auto ct = mdspan_cute::compress_tiles(
+//       weights, cute::make_shape(cute::Int<64>{}, cute::Int<64>{}));
+//   ct.stats().ratio();                      // raw bytes / stored bytes
+//
+//   std::vector<float> scratch(ct.max_tile_size());
+//   auto tile = ct.decompress_tile({i, j}, scratch.data());
+//   tile[r, c] ...;                          // (≤ 64, ≤ 64) row-major view
+//
+// The tensor is split with tile_split (tile_iteration.h), so edge tiles are
+// clipped rather than padded, and every tile is encoded independently:
+//
+//   gather   tile elements in row-major order (through the source mapping,
+//            so any layout works)
+//   shuffle  byte planes: byte b of every element, then byte b + 1, ...;
+//            exponents and high bytes of similar values line up
+//   delta    (tile_codec::delta_lz) byte differences within each plane
+//   lz       in-tree LZ77 with a 4-byte hash and 64 KiB window, LZ4-like
+//            sequences (token, literals, 16-bit offset, match length)
+//
+// A tile whose encoding is not smaller than the raw bytes is stored raw.
+// Any tile can be decoded on its own into caller scratch, so a reader
+// touches only the tiles it needs. decode_throughput() times a full decode
+// pass for reporting.
+
+#pragma once
+
+#include <mdspan_cute/index_space.h>
+#include <mdspan_cute/layout_cute.h>
+#include <mdspan_cute/parallel.h>
+#include <mdspan_cute/tile_iteration.h>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <cute/layout.hpp>
+
+namespace mdspan_cute {
+
+// Encoding of a tile after the byte shuffle
+enum class tile_codec : std::uint8_t {
+  raw,      // stored as is (also the fallback when nothing is gained)
+  lz,       // shuffle + LZ
+  delta_lz, // shuffle + per-plane byte delta + LZ
+};
+
+struct compression_stats {
+  std::size_t tiles = 0;
+  std::size_t raw_tiles = 0;        // tiles stored without compression
+  std::size_t raw_bytes = 0;        // uncompressed size of all tiles
+  std::size_t compressed_bytes = 0; // stored size of all tiles
+
+  [[nodiscard]] constexpr auto ratio() const noexcept -> double {
+    return compressed_bytes == 0
+               ? 1.0
+               : static_cast<double>(raw_bytes) /
+                     static_cast<double>(compressed_bytes);
+  }
+};
+
+// ═══════════════════════════════════════════════════════════════════════════════
+namespace detail {
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Byte shuffle and per-plane delta
+// ─────────────────────────────────────────────────────────────────────────────
+
+// out[b · n + i] = in[i · size + b]
+inline void byte_shuffle(std::uint8_t const *in, std::uint8_t *out,
+                         std::size_t n, std::size_t size) noexcept {
+  for (std::size_t i = 0; i < n; ++i)
+    for (std::size_t b = 0; b < size; ++b)
+      out[b * n + i] = in[i * size + b];
+}
+
+inline void byte_unshuffle(std::uint8_t const *in, std::uint8_t *out,
+                           std::size_t n, std::size_t size) noexcept {
+  for (std::size_t b = 0; b < size; ++b)
+    for (std::size_t i = 0; i < n; ++i)
+      out[i * size + b] = in[b * n + i];
+}
+
+inline void delta_encode(std::uint8_t *p, std::size_t n,
+                         std::size_t planes) noexcept {
+  for (std::size_t b = 0; b < planes; ++b)
+    for (std::size_t i = n; i-- > 1;)
+      p[b * n + i] = static_cast<std::uint8_t>(p[b * n + i] -
+                                               p[b * n + i - 1]);
+}
+
+inline void delta_decode(std::uint8_t *p, std::size_t n,
+                         std::size_t planes) noexcept {
+  for (std::size_t b = 0; b < planes; ++b)
+    for (std::size_t i = 1; i < n; ++i)
+      p[b * n + i] = static_cast<std::uint8_t>(p[b * n + i] +
+                                               p[b * n + i - 1]);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// LZ77 block codec
+// Sequence: token (literal length << 4 | match length − 4, 15 = extended by
+// 255-continued bytes), literals, 16-bit little-endian offset, extension.
+// The last sequence has literals only; the decoder stops at the known size.
+// ─────────────────────────────────────────────────────────────────────────────
+
+inline constexpr std::size_t lz_min_match = 4;
+inline constexpr int lz_hash_bits = 12;
+inline constexpr std::size_t lz_window = 65535;
+
+inline void lz_compress(std::uint8_t const *in, std::size_t n,
+                        std::vector<std::uint8_t> &out) {
+  // Positions + 1 of the last 4-byte sequence per hash bucket (0 = empty)
+  std::array<std::uint32_t, std::size_t{1} << lz_hash_bits> table{};
+  auto load32 = [&](std::size_t i) {
+    std::uint32_t v;
+    std::memcpy(&v, in + i, 4);
+    return v;
+  };
+  auto hash = [](std::uint32_t v) {
+    return (v * 2654435761u) >> (32 - lz_hash_bits);
+  };
+  auto put_length = [&](std::size_t len) {
+    for (; len >= 255; len -= 255)
+      out.push_back(255);
+    out.push_back(static_cast<std::uint8_t>(len));
+  };
+  auto emit = [&](std::size_t lit_begin, std::size_t lit_len,
+                  std::size_t offset, std::size_t match_len) {
+    std::size_t const ml = match_len ? match_len - lz_min_match : 0;
+    out.push_back(static_cast<std::uint8_t>((std::min<std::size_t>(lit_len,
+                                                                    15)
+                                             << 4) |
+                                            std::min<std::size_t>(ml, 15)));
+    if (lit_len >= 15)
+      put_length(lit_len - 15);
+    out.insert(out.end(), in + lit_begin, in + lit_begin + lit_len);
+    if (match_len == 0)
+      return;
+    out.push_back(static_cast<std::uint8_t>(offset & 0xff));
+    out.push_back(static_cast<std::uint8_t>(offset >> 8));
+    if (ml >= 15)
+      put_length(ml - 15);
+  };
+
+  std::size_t anchor = 0, i = 0;
+  while (i + lz_min_match <= n) {
+    std::uint32_t const v = load32(i);
+    auto const h = hash(v);
+    std::size_t const cand = table[h];
+    table[h] = static_cast<std::uint32_t>(i + 1);
+    if (cand != 0 && i - (cand - 1) <= lz_window && load32(cand - 1) == v) {
+      std::size_t const from = cand - 1;
+      std::size_t len = lz_min_match;
+      while (i + len < n && in[from + len] == in[i + len])
+        ++len;
+      emit(anchor, i - anchor, i - from, len);
+      i += len;
+      anchor = i;
+    } else {
+      ++i;
+    }
+  }
+  emit(anchor, n - anchor, 0, 0);
+}
+
+// False on malformed input
+[[nodiscard]] inline bool lz_decompress(std::uint8_t const *in,
+                                        std::size_t in_n, std::uint8_t *out,
+                                        std::size_t out_n) noexcept {
+  std::size_t ip = 0, op = 0;
+  auto get_length = [&](std::size_t len, bool &ok) {
+    if (len != 15)
+      return len;
+    std::uint8_t b;
+    do {
+      if (ip >= in_n) {
+        ok = false;
+        return len;
+      }
+      b = in[ip++];
+      len += b;
+    } while (b == 255);
+    return len;
+  };
+
+  while (ip < in_n) {
+    bool ok = true;
+    std::uint8_t const token = in[ip++];
+    std::size_t const lit = get_length(token >> 4, ok);
+    if (!ok || lit > in_n - ip || lit > out_n - op)
+      return false;
+    std::memcpy(out + op, in + ip, lit);
+    ip += lit;
+    op += lit;
+    if (op == out_n)
+      return ip == in_n;
+    if (in_n - ip < 2)
+      return false;
+    std::size_t const offset = std::size_t{in[ip]} |
+                               (std::size_t{in[ip + 1]} << 8);
+    ip += 2;
+    std::size_t const ml = get_length(token & 15u, ok) + lz_min_match;
+    if (!ok || offset == 0 || offset > op || ml > out_n - op)
+      return false;
+    for (std::size_t k = 0; k < ml; ++k, ++op)
+      out[op] = out[op - offset]; // may overlap: byte at a time
+  }
+  return false;
+}
+
+} // namespace detail
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// compressed_tensor: a tensor stored as independently decodable tiles
+// ═══════════════════════════════════════════════════════════════════════════════
+
+template <class T, class Extents, class Tiler> class compressed_tensor {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "mdspan_cute::compressed_tensor: T must be trivially "
+                "copyable");
+
+public:
+  using value_type = T;
+  using extents_type = Extents;
+  using split_type = tile_split<Extents, Tiler>;
+  using coord_type = typename split_type::coord_type;
+  static constexpr std::size_t rank = Extents::rank();
+
+  template <class TS, class LS, class AS>
+  compressed_tensor(std::mdspan<TS, Extents, LS, AS> src, Tiler const &tiler,
+                    tile_codec codec = tile_codec::delta_lz,
+                    std::size_t num_threads = default_num_threads())
+      : split_(src.extents(), tiler),
+        extent_(detail::extents_array(src.extents())) {
+    std::size_t const n = tile_count();
+    std::vector<std::vector<std::uint8_t>> encoded(n);
+    codecs_.resize(n);
+    parallel_for_chunks(n, threads_for(src.size(), num_threads),
+                        [&](std::size_t b, std::size_t e) {
+                          std::vector<T> elems;
+                          for (std::size_t t = b; t < e; ++t)
+                            encode(src, t, codec, elems, encoded[t]);
+                        });
+
+    offsets_.resize(n + 1);
+    for (std::size_t t = 0; t < n; ++t)
+      offsets_[t + 1] = offsets_[t] + encoded[t].size();
+    data_.reserve(offsets_[n]);
+    for (auto const &bytes : encoded)
+      data_.insert(data_.end(), bytes.begin(), bytes.end());
+
+    stats_.tiles = n;
+    stats_.compressed_bytes = data_.size();
+    stats_.raw_bytes = static_cast<std::size_t>(src.size()) * sizeof(T);
+    stats_.raw_tiles = static_cast<std::size_t>(
+        std::count(codecs_.begin(), codecs_.end(), tile_codec::raw));
+  }
+
+  // ─────────────────────────────────────────────────────────────────────
+  // Observers
+  // ─────────────────────────────────────────────────────────────────────
+
+  [[nodiscard]] auto split() const noexcept -> split_type const & {
+    return split_;
+  }
+  [[nodiscard]] auto stats() const noexcept -> compression_stats const & {
+    return stats_;
+  }
+  [[nodiscard]] auto tile_count() const noexcept -> std::size_t {
+    std::size_t n = 1;
+    for (auto c : split_.tile_counts())
+      n *= static_cast<std::size_t>(c);
+    return n;
+  }
+  // Elements in a full tile: enough scratch for any tile
+  [[nodiscard]] auto max_tile_size() const noexcept -> std::size_t {
+    std::size_t n = 1;
+    for (auto e : split_.tile_extents())
+      n *= static_cast<std::size_t>(e);
+    return n;
+  }
+  [[nodiscard]] auto codec(coord_type const &t) const -> tile_codec {
+    return codecs_[linear(t)];
+  }
+
+  // ─────────────────────────────────────────────────────────────────────
+  // Decoding
+  // ─────────────────────────────────────────────────────────────────────
+
+  // Decode tile t into scratch (≥ max_tile_size() elements); returns the
+  // clipped tile as a row-major layout_cute mdspan over scratch
+  auto decompress_tile(coord_type const &t, T *scratch) const {
+    auto const lo = split_.tile_begin(t), hi = split_.tile_end(t);
+    std::array<std::int64_t, rank> ext{};
+    std::size_t count = 1;
+    for (std::size_t k = 0; k < rank; ++k) {
+      ext[k] = static_cast<std::int64_t>(hi[k] - lo[k]);
+      count *= static_cast<std::size_t>(ext[k]);
+    }
+    decode(linear(t), count, scratch);
+    auto const shape = [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+      return cute::make_shape(ext[Is]...);
+    }(std::make_index_sequence<rank>{});
+    return make_mdspan(scratch, cute::make_layout(shape, cute::LayoutRight{}));
+  }
+
+  // Decode every tile into dst (same extents as the source)
+  template <class TD, class ED, class LD, class AD>
+  void decompress(std::mdspan<TD, ED, LD, AD> dst,
+                  std::size_t num_threads = default_num_threads()) const {
+    static_assert(ED::rank() == rank,
+                  "mdspan_cute::compressed_tensor::decompress: rank mismatch");
+    for (std::size_t k = 0; k < rank; ++k)
+      assert(static_cast<std::size_t>(dst.extent(k)) ==
+             static_cast<std::size_t>(extent_[k]));
+    std::size_t const n = tile_count();
+    parallel_for_chunks(
+        n, threads_for(stats_.raw_bytes / sizeof(T), num_threads),
+        [&](std::size_t b, std::size_t e) {
+          std::vector<T> scratch(max_tile_size());
+          for (std::size_t i = b; i < e; ++i) {
+            auto const t = coord_of(i);
+            auto const tile = decompress_tile(t, scratch.data());
+            auto const lo = split_.tile_begin(t), hi = split_.tile_end(t);
+            coord_type c{};
+            auto body = [&](coord_type const &g) {
+              coord_type l{};
+              for (std::size_t k = 0; k < rank; ++k)
+                l[k] = g[k] - lo[k];
+              detail::element_at(dst, g) = detail::element_at(tile, l);
+            };
+            detail::for_each_in_box(lo, hi, c, body);
+          }
+        });
+  }
+
+  // Bytes of decoded tensor per second over `passes` full decode passes
+  [[nodiscard]] auto decode_throughput(std::size_t passes = 1) const
+      -> double {
+    std::vector<T> scratch(max_tile_size());
+    std::size_t const n = tile_count();
+    auto const start = std::chrono::steady_clock::now();
+    for (std::size_t p = 0; p < passes; ++p)
+      for (std::size_t i = 0; i < n; ++i)
+        (void)decompress_tile(coord_of(i), scratch.data());
+    std::chrono::duration<double> const secs =
+        std::chrono::steady_clock::now() - start;
+    return secs.count() > 0.0 ? static_cast<double>(stats_.raw_bytes) *
+                                    static_cast<double>(passes) / secs.count()
+                              : 0.0;
+  }
+
+private:
+  split_type split_;
+  coord_type extent_;
+  std::vector<std::uint8_t> data_;
+  std::vector<std::size_t> offsets_;
+  std::vector<tile_codec> codecs_;
+  compression_stats stats_;
+
+  // Tiles are numbered row-major over the tile counts
+  [[nodiscard]] auto linear(coord_type const &t) const -> std::size_t {
+    std::size_t i = 0;
+    for (std::size_t k = 0; k < rank; ++k)
+      i = i * static_cast<std::size_t>(split_.tile_counts()[k]) +
+          static_cast<std::size_t>(t[k]);
+    return i;
+  }
+  [[nodiscard]] auto coord_of(std::size_t i) const -> coord_type {
+    coord_type t{};
+    for (std::size_t k = rank; k-- > 0;) {
+      auto const c = static_cast<std::size_t>(split_.tile_counts()[k]);
+      t[k] = static_cast<typename coord_type::value_type>(i % c);
+      i /= c;
+    }
+    return t;
+  }
+
+  template <class Src>
+  void encode(Src const &src, std::size_t i, tile_codec codec,
+              std::vector<T> &elems, std::vector<std::uint8_t> &out) {
+    auto const t = coord_of(i);
+    auto const lo = split_.tile_begin(t), hi = split_.tile_end(t);
+    elems.clear();
+    coord_type c{};
+    auto gather = [&](coord_type const &g) {
+      elems.push_back(static_cast<T>(detail::element_at(src, g)));
+    };
+    detail::for_each_in_box(lo, hi, c, gather);
+
+    std::size_t const bytes = elems.size() * sizeof(T);
+    auto const *raw = reinterpret_cast<std::uint8_t const *>(elems.data());
+    if (codec != tile_codec::raw && bytes > 0) {
+      std::vector<std::uint8_t> planes(bytes);
+      detail::byte_shuffle(raw, planes.data(), elems.size(), sizeof(T));
+      if (codec == tile_codec::delta_lz)
+        detail::delta_encode(planes.data(), elems.size(), sizeof(T));
+      detail::lz_compress(planes.data(), bytes, out);
+      if (out.size() < bytes) {
+        codecs_[i] = codec;
+        return;
+      }
+      out.clear();
+    }
+    out.assign(raw, raw + bytes);
+    codecs_[i] = tile_codec::raw;
+  }
+
+  void decode(std::size_t i, std::size_t count, T *scratch) const {
+    std::uint8_t const *in = data_.data() + offsets_[i];
+    std::size_t const in_n = offsets_[i + 1] - offsets_[i];
+    std::size_t const bytes = count * sizeof(T);
+    auto *out = reinterpret_cast<std::uint8_t *>(scratch);
+    if (codecs_[i] == tile_codec::raw) {
+      assert(in_n == bytes);
+      std::memcpy(out, in, bytes);
+      return;
+    }
+    thread_local std::vector<std::uint8_t> planes;
+    planes.resize(bytes);
+    [[maybe_unused]] bool const ok =
+        detail::lz_decompress(in, in_n, planes.data(), bytes);
+    assert(ok && "mdspan_cute::compressed_tensor: corrupt tile");
+    if (codecs_[i] == tile_codec::delta_lz)
+      detail::delta_decode(planes.data(), count, sizeof(T));
+    detail::byte_unshuffle(planes.data(), out, count, sizeof(T));
+  }
+};
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// compress_tiles(src, tiler[, codec[, num_threads]])
+// ═══════════════════════════════════════════════════════════════════════════════
+
+template <class T, class E, class L, class A, class Tiler>
+[[nodiscard]] auto compress_tiles(std::mdspan<T, E, L, A> src,
+                                  Tiler const &tiler,
+                                  tile_codec codec = tile_codec::delta_lz,
+                                  std::size_t num_threads =
+                                      default_num_threads()) {
+  return compressed_tensor<std::remove_const_t<T>, E, Tiler>(
+      src, tiler, codec, num_threads);
+}
+
+} // namespace mdspan_cute
@@ -0,0 +1,230 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// Copyright 2026 Weyl AI
+//
+// mdspan_cute/convert.h
+//
+// Narrow float storage types and a fused convert-and-relayout copy.
+//
+//   auto src = std::mdspan<float const, std::dextents<int, 2>>(x, 64, 64);
+//   auto dst = mdspan_cute::make_mdspan(staging, swizzle::make_swizzled_layout<
+//       swizzle::sw128>(cute::make_shape(cute::Int<64>{}, cute::Int<64>{}),
+//                       cute::LayoutRight{}));              // bf16_t tile
+//   mdspan_cute::convert_copy(src, dst);  // dst[i, j] = bf16_t(src[i, j])
+//
+// convert_copy is permute_copy (permute.h) with an element conversion, so
+// each element is read once in the source's layout and written once in the
+// destination's: the engine tiles over the innermost modes of both
+// mappings and converts while filling the micro-tile, which runs along the
+// source's contiguous mode. The conversions below are branch-free selects
+// over integer and float ops, so that loop vectorizes; fp16 uses the F16C
+// instructions through _Float16 when the target has them.
+//
+// Storage types (bit patterns, converted through float):
+//   bf16_t      1-8-7, round to nearest even, NaN stays quiet NaN
+//   fp16_t      IEEE binary16, round to nearest even, overflow → inf
+//   fp8_e4m3_t  OCP E4M3FN (bias 7, no inf), round to nearest even,
+//               saturates to ±448, NaN → 0x7f
+
+#pragma once
+
+#include <mdspan_cute/parallel.h>
+#include <mdspan_cute/permute.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <type_traits>
+
+namespace mdspan_cute {
+
+// ═══════════════════════════════════════════════════════════════════════════════
+namespace detail {
+
+// ─────────────────────────────────────────────────────────────────────────────
+// bf16
+// ─────────────────────────────────────────────────────────────────────────────
+
+[[nodiscard]] constexpr auto bf16_from_float(float f) noexcept
+    -> std::uint16_t {
+  auto const u = std::bit_cast<std::uint32_t>(f);
+  auto const rounded = (u + 0x7fffu + ((u >> 16) & 1u)) >> 16;
+  auto const nan = (u >> 16) | 0x40u;
+  return static_cast<std::uint16_t>((u & 0x7fffffffu) > 0x7f800000u ? nan
+                                                                    : rounded);
+}
+
+[[nodiscard]] constexpr auto bf16_to_float(std::uint16_t b) noexcept
+    -> float {
+  return std::bit_cast<float>(std::uint32_t{b} << 16);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// fp16 (after Maratyszcza's FP16 library: the float adds do the rounding)
+// ─────────────────────────────────────────────────────────────────────────────
+
+[[nodiscard]] constexpr auto fp16_from_float_portable(float f) noexcept
+    -> std::uint16_t {
+  auto const w = std::bit_cast<std::uint32_t>(f);
+  float const abs_f = std::bit_cast<float>(w & 0x7fffffffu);
+  float base = (abs_f * 0x1.0p+112f) * 0x1.0p-110f;
+  auto const shl1_w = w + w;
+  auto const sign = w & 0x80000000u;
+  auto const bias = std::max(shl1_w & 0xff000000u, 0x71000000u);
+  base = std::bit_cast<float>((bias >> 1) + 0x07800000u) + base;
+  auto const bits = std::bit_cast<std::uint32_t>(base);
+  auto const nonsign = ((bits >> 13) & 0x7c00u) + (bits & 0x0fffu);
+  return static_cast<std::uint16_t>((sign >> 16) |
+                                    (shl1_w > 0xff000000u ? 0x7e00u
+                                                          : nonsign));
+}
+
+[[nodiscard]] constexpr auto fp16_to_float_portable(std::uint16_t h) noexcept
+    -> float {
+  auto const w = std::uint32_t{h} << 16;
+  auto const sign = w & 0x80000000u;
+  auto const two_w = w + w;
+  float const normalized =
+      std::bit_cast<float>((two_w >> 4) + (0xe0u << 23)) * 0x1.0p-112f;
+  float const denormalized =
+      std::bit_cast<float>((two_w >> 17) | (126u << 23)) - 0.5f;
+  return std::bit_cast<float>(
+      sign | (two_w < (1u << 27) ? std::bit_cast<std::uint32_t>(denormalized)
+                                 : std::bit_cast<std::uint32_t>(normalized)));
+}
+
+[[nodiscard]] constexpr auto fp16_from_float(float f) noexcept
+    -> std::uint16_t {
+#if defined(__F16C__) && defined(__FLT16_MAX__)
+  if !consteval {
+    return std::bit_cast<std::uint16_t>(static_cast<_Float16>(f));
+  }
+#endif
+  return fp16_from_float_portable(f);
+}
+
+[[nodiscard]] constexpr auto fp16_to_float(std::uint16_t h) noexcept
+    -> float {
+#if defined(__F16C__) && defined(__FLT16_MAX__)
+  if !consteval {
+    return static_cast<float>(std::bit_cast<_Float16>(h));
+  }
+#endif
+  return fp16_to_float_portable(h);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// fp8 E4M3FN
+// ─────────────────────────────────────────────────────────────────────────────
+
+[[nodiscard]] constexpr auto e4m3_from_float(float f) noexcept
+    -> std::uint8_t {
+  auto const u = std::bit_cast<std::uint32_t>(f);
+  auto const sign = (u >> 24) & 0x80u;
+  auto const a = u & 0x7fffffffu;
+  float const af = std::min(std::bit_cast<float>(a), 448.0f);
+
+  // Subnormals (|f| < 2^-6) are multiples of 2^-9; the magic add rounds to
+  // nearest even and 8 · 2^-9 lands on the smallest normal encoding
+  float const scaled = af * 512.0f;
+  auto const sub =
+      static_cast<std::uint32_t>((scaled + 0x1.0p23f) - 0x1.0p23f);
+
+  // Normals: round the mantissa to 3 bits, then rebias 127 → 7
+  auto const ab = std::bit_cast<std::uint32_t>(af);
+  auto const r = (ab + 0x7ffffu + ((ab >> 20) & 1u)) & ~0xfffffu;
+  auto const normal = (((r >> 23) - 120u) << 3) | ((r >> 20) & 7u);
+
+  auto const mag = af < 0x1.0p-6f ? sub : normal;
+  return static_cast<std::uint8_t>(sign | (a > 0x7f800000u ? 0x7fu : mag));
+}
+
+[[nodiscard]] constexpr auto e4m3_to_float(std::uint8_t b) noexcept
+    -> float {
+  std::uint32_t const sign = std::uint32_t{b & 0x80u} << 24;
+  std::uint32_t const exp = (b >> 3) & 0xfu, mant = b & 7u;
+  float const sub = static_cast<float>(mant) * 0x1.0p-9f;
+  float const normal =
+      std::bit_cast<float>(((exp + 120u) << 23) | (mant << 20));
+  float const mag = (b & 0x7fu) == 0x7fu ? std::bit_cast<float>(0x7fc00000u)
+                    : exp == 0          ? sub
+                                        : normal;
+  return std::bit_cast<float>(sign | std::bit_cast<std::uint32_t>(mag));
+}
+
+} // namespace detail
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Storage types
+// ═══════════════════════════════════════════════════════════════════════════════
+
+struct bf16_t {
+  std::uint16_t bits;
+
+  constexpr bf16_t() = default;
+  explicit constexpr bf16_t(float f) noexcept
+      : bits(detail::bf16_from_float(f)) {}
+  explicit constexpr operator float() const noexcept {
+    return detail::bf16_to_float(bits);
+  }
+  friend constexpr bool operator==(bf16_t, bf16_t) = default;
+};
+
+struct fp16_t {
+  std::uint16_t bits;
+
+  constexpr fp16_t() = default;
+  explicit constexpr fp16_t(float f) noexcept
+      : bits(detail::fp16_from_float(f)) {}
+  explicit constexpr operator float() const noexcept {
+    return detail::fp16_to_float(bits);
+  }
+  friend constexpr bool operator==(fp16_t, fp16_t) = default;
+};
+
+struct fp8_e4m3_t {
+  std::uint8_t bits;
+
+  constexpr fp8_e4m3_t() = default;
+  explicit constexpr fp8_e4m3_t(float f) noexcept
+      : bits(detail::e4m3_from_float(f)) {}
+  explicit constexpr operator float() const noexcept {
+    return detail::e4m3_to_float(bits);
+  }
+  friend constexpr bool operator==(fp8_e4m3_t, fp8_e4m3_t) = default;
+};
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// convert_to<D>: element conversion; storage types go through float
+// ═══════════════════════════════════════════════════════════════════════════════
+
+template <class D> struct convert_to {
+  template <class S>
+  [[nodiscard]] constexpr auto operator()(S const &s) const noexcept -> D {
+    if constexpr (std::is_arithmetic_v<D> && std::is_arithmetic_v<S>)
+      return static_cast<D>(s);
+    else if constexpr (std::is_constructible_v<D, S const &>)
+      return D(s);
+    else
+      return D(static_cast<float>(s));
+  }
+};
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// convert_copy(src, dst[, num_threads]): dst[c] = D(src[c]) across layouts
+// ═══════════════════════════════════════════════════════════════════════════════
+
+template <class TS, class ES, class LS, class AS, class TD, class ED,
+          class LD, class AD>
+void convert_copy(std::mdspan<TS, ES, LS, AS> src,
+                  std::mdspan<TD, ED, LD, AD> dst,
+                  std::size_t num_threads = default_num_threads()) {
+  std::array<std::size_t, ES::rank()> perm{};
+  std::iota(perm.begin(), perm.end(), std::size_t{0});
+  permute_copy(src, dst, perm, convert_to<std::remove_cv_t<TD>>{},
+               num_threads);
+}
+
+} // namespace mdspan_cute
@@ -0,0 +1,195 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// Copyright 2026 Weyl AI
+//
+// mdspan_cute/curve_layouts.h
+//
+// Space-filling-curve layouts: Morton (Z-order) and Hilbert.
+//
+//   auto z = mdspan_cute::make_morton_layout(cute::make_shape(1024, 1024));
+//   auto grid = mdspan_cute::make_mdspan(ptr, z);    // grid[i, j]
+//
+//   auto h = mdspan_cute::make_hilbert_layout(1024); // 1024×1024
+//
+// Both are cute ComposedLayouts: a curve functor applied after a compact
+// column-major layout, the same construction cute uses for swizzles. They
+// satisfy cute_layout and wrap in layout_cute like any other cute layout.
+//
+// For power-of-two extents the column-major offset is the bit concatenation
+// of the coordinates, so the functor can read every coordinate back out of
+// it. Morton interleaves those bit fields; with more bits in some modes the
+// extra high bits of those modes follow the interleaved part. Hilbert
+// (rank 2, square) maps them to the distance along the Hilbert curve, whose
+// consecutive cells are always grid neighbours.
+//
+// Neighbours along any mode stay close in memory, so row and column sweeps
+// (and stencils, transposes) both get locality without picking a blocking
+// factor. Extents must be powers of two; pad larger grids up and view the
+// interior. Both layouts are bijections onto [0, size).
+//
+// Bit deposit uses BMI2 pdep when compiled with -mbmi2 (or -march with BMI2)
+// and a portable loop otherwise.
+
+#pragma once
+
+#include <mdspan_cute/layout_cute.h>
+
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include <cute/layout.hpp>
+
+#if defined(__BMI2__)
+#include <immintrin.h>
+#endif
+
+namespace mdspan_cute {
+
+// ═══════════════════════════════════════════════════════════════════════════════
+namespace detail {
+
+// Scatter the low bits of x to the set bits of mask (pdep semantics)
+constexpr auto deposit_bits_portable(std::uint64_t x,
+                                     std::uint64_t mask) noexcept
+    -> std::uint64_t {
+  std::uint64_t r = 0;
+  for (std::uint64_t bit = 1; mask != 0; mask &= mask - 1, bit <<= 1)
+    if (x & bit)
+      r |= mask & (~mask + 1);
+  return r;
+}
+
+constexpr auto deposit_bits(std::uint64_t x, std::uint64_t mask) noexcept
+    -> std::uint64_t {
+#if defined(__BMI2__)
+  if !consteval {
+    return _pdep_u64(x, mask);
+  }
+#endif
+  return deposit_bits_portable(x, mask);
+}
+
+// log2 of a power-of-two extent
+template <class E> constexpr auto extent_bits(E const &e) -> int {
+  auto const n = to_size_t(e);
+  assert(std::has_single_bit(n) &&
+         "mdspan_cute: curve layouts need power-of-two extents");
+  return std::countr_zero(n);
+}
+
+// Offsets are returned in the type they came in (int for cute::Int sums)
+template <class I>
+using curve_offset_t = std::conditional_t<std::is_integral_v<I>, I,
+                                          std::int64_t>;
+
+} // namespace detail
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// morton_fn<R>: colex bit concatenation → Z-order offset
+// ═══════════════════════════════════════════════════════════════════════════════
+
+template <std::size_t R> struct morton_fn {
+  std::array<int, R> shift{};        // start of mode k's field in the input
+  std::array<std::uint64_t, R> field{}; // (1 << bits_k) − 1
+  std::array<std::uint64_t, R> mask{};  // mode k's bits in the output
+
+  constexpr morton_fn() = default;
+
+  constexpr explicit morton_fn(std::array<int, R> const &bits) {
+    int s = 0;
+    for (std::size_t k = 0; k < R; ++k) {
+      shift[k] = s;
+      field[k] = (std::uint64_t{1} << bits[k]) - 1;
+      s += bits[k];
+    }
+    assert(s <= 64 && "mdspan_cute::morton_fn: more than 64 offset bits");
+    // Round-robin over the modes that still have bits at each level
+    int out = 0;
+    for (int level = 0; out < s; ++level)
+      for (std::size_t k = 0; k < R; ++k)
+        if (level < bits[k])
+          mask[k] |= std::uint64_t{1} << out++;
+  }
+
+  template <class I>
+  [[nodiscard]] constexpr auto operator()(I const &offset) const noexcept
+      -> detail::curve_offset_t<I> {
+    auto const p = static_cast<std::uint64_t>(offset);
+    std::uint64_t r = 0;
+    for (std::size_t k = 0; k < R; ++k)
+      r |= detail::deposit_bits((p >> shift[k]) & field[k], mask[k]);
+    return static_cast<detail::curve_offset_t<I>>(r);
+  }
+
+  // A bit permutation: a bijection on [0, 2^bits)
+  [[nodiscard]] constexpr bool is_injective() const noexcept { return true; }
+
+  friend constexpr bool operator==(morton_fn const &,
+                                   morton_fn const &) = default;
+};
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// hilbert_fn: (x + y·n) → distance along the Hilbert curve of an n×n grid
+// ═══════════════════════════════════════════════════════════════════════════════
+
+struct hilbert_fn {
+  int bits = 0; // n = 2^bits
+
+  template <class I>
+  [[nodiscard]] constexpr auto operator()(I const &offset) const noexcept
+      -> detail::curve_offset_t<I> {
+    auto const p = static_cast<std::uint64_t>(offset);
+    std::uint64_t const n = std::uint64_t{1} << bits;
+    std::uint64_t x = p & (n - 1), y = p >> bits, d = 0;
+    for (std::uint64_t s = n / 2; s > 0; s /= 2) {
+      std::uint64_t const rx = (x & s) != 0, ry = (y & s) != 0;
+      d += s * s * ((3 * rx) ^ ry);
+      // Rotate the quadrant so the sub-curve starts at its origin
+      if (ry == 0) {
+        if (rx == 1) {
+          x = n - 1 - x;
+          y = n - 1 - y;
+        }
+        std::swap(x, y);
+      }
+    }
+    return static_cast<detail::curve_offset_t<I>>(d);
+  }
+
+  [[nodiscard]] constexpr bool is_injective() const noexcept { return true; }
+
+  friend constexpr bool operator==(hilbert_fn const &,
+                                   hilbert_fn const &) = default;
+};
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Factories
+// ═══════════════════════════════════════════════════════════════════════════════
+
+// Morton layout over a flat shape of power-of-two extents (any rank)
+template <class Shape>
+[[nodiscard]] constexpr auto make_morton_layout(Shape const &shape) {
+  auto const flat = detail::flatten_shape(shape);
+  constexpr std::size_t R =
+      cute::tuple_size<std::remove_cvref_t<decltype(flat)>>::value;
+  std::array<int, R> bits{};
+  [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+    ((bits[Is] = detail::extent_bits(cute::get<Is>(flat))), ...);
+  }(std::make_index_sequence<R>{});
+  return cute::composition(morton_fn<R>(bits), cute::Int<0>{},
+                           cute::make_layout(shape));
+}
+
+// Hilbert layout over an n×n grid, n a power of two
+template <class N>
+[[nodiscard]] constexpr auto make_hilbert_layout(N const &n) {
+  return cute::composition(hilbert_fn{detail::extent_bits(n)},
+                           cute::Int<0>{},
+                           cute::make_layout(cute::make_shape(n, n)));
+}
+
+} // namespace mdspan_cute
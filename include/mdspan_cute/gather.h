@@ -0,0 +1,192 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// Copyright 2026 Weyl AI
+//
+// mdspan_cute/gather.h
+//
+// Gather/scatter of whole slices by an index list (numpy take / put).
+//
+//   // out[k, d] = table[ids[k], d]; the table may be swizzled or blocked
+//   mdspan_cute::take(table, ids, out);
+//   mdspan_cute::take(table, ids, out, 0, index_order::by_cache_line);
+//
+//   // table[ids[k], d] = rows[k, d]
+//   mdspan_cute::put(table, ids, rows);
+//
+// Indices are logical coordinates along `mode` (default 0); every other mode
+// is copied whole, so dst and src agree on all extents except `mode`, where
+// the indexed side has the table's extent and the other side has
+// size(indices).
+//
+// With index_order::by_cache_line the indices are stably sorted by the
+// cache line holding the first element of their slice, computed through the
+// table's layout function, and executed in that order. Repeated and nearby
+// rows are then visited together instead of at random. Results still land
+// at their own position k, so the sort needs no undo pass. Element access
+// goes through the mappings, so swizzled and other non-affine tables work
+// unchanged.
+//
+// take splits the indices across threads. So does put, after dropping every
+// occurrence of a repeated index but the last: each table slice then has a
+// single writer, so repeats (e.g. tokens routed to the same expert row) are
+// race-free and the last occurrence wins for any num_threads.
+
+#pragma once
+
+#include <mdspan_cute/index_space.h>
+#include <mdspan_cute/layout_cute.h>
+#include <mdspan_cute/parallel.h>
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <numeric>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+namespace mdspan_cute {
+
+// Execution order of an index list
+enum class index_order {
+  as_given,      // indices in list order
+  by_cache_line, // stable sort by the table cache line of each slice
+};
+
+inline constexpr std::size_t gather_cache_line = 64;
+
+// ═══════════════════════════════════════════════════════════════════════════════
+namespace detail {
+
+template <class R>
+concept index_list = std::ranges::random_access_range<R const> &&
+                     std::ranges::sized_range<R const> &&
+                     std::integral<std::ranges::range_value_t<R const>>;
+
+// Positions of `indices` in execution order. With last_only, positions whose
+// index repeats later in the list are dropped.
+template <class Table, class Indices>
+[[nodiscard]] auto index_schedule(Table const &table, Indices const &indices,
+                                  std::size_t mode, index_order order,
+                                  bool last_only)
+    -> std::vector<std::size_t> {
+  std::size_t const n = std::ranges::size(indices);
+  auto it = std::ranges::begin(indices);
+  std::vector<std::size_t> sched(n);
+  std::iota(sched.begin(), sched.end(), std::size_t{0});
+  if (last_only) {
+    // Stable by index: each run of equal indices ends at its last position
+    std::vector<std::size_t> by_index = sched;
+    std::ranges::stable_sort(by_index, {},
+                             [&](std::size_t k) { return it[k]; });
+    std::vector<bool> keep(n, true);
+    for (std::size_t p = 0; p + 1 < n; ++p)
+      if (it[by_index[p]] == it[by_index[p + 1]])
+        keep[by_index[p]] = false;
+    std::erase_if(sched, [&](std::size_t k) { return !keep[k]; });
+  }
+  if (order == index_order::as_given)
+    return sched;
+
+  using element_type = typename Table::element_type;
+  index_array<typename Table::extents_type> c{};
+  std::vector<std::size_t> line(n);
+  for (std::size_t k : sched) {
+    c[mode] = static_cast<typename Table::index_type>(it[k]);
+    line[k] = static_cast<std::size_t>(offset_at(table.mapping(), c)) *
+              sizeof(element_type) / gather_cache_line;
+  }
+  std::ranges::stable_sort(sched, {},
+                           [&](std::size_t k) { return line[k]; });
+  return sched;
+}
+
+// dst[..., di, ...] = src[..., si, ...] for one slice along `mode`
+template <class Dst, class Src, class Index>
+void copy_slice(Dst const &dst, Src const &src, std::size_t mode, Index di,
+                Index si) {
+  using coord_type = index_array<typename Src::extents_type>;
+  using value_type = typename Dst::value_type;
+  coord_type lo{}, hi = extents_array(src.extents()), c{};
+  hi[mode] = 1;
+  auto body = [&](coord_type const &sc) {
+    coord_type s = sc, d = sc;
+    s[mode] = static_cast<typename coord_type::value_type>(si);
+    d[mode] = static_cast<typename coord_type::value_type>(di);
+    element_at(dst, d) = static_cast<value_type>(element_at(src, s));
+  };
+  for_each_in_box(lo, hi, c, body);
+}
+
+// Shared driver: `table` is the indexed operand, `other` the dense one
+template <class Table, class Other, class Indices, class F>
+void indexed_slices(Table const &table, Other const &other,
+                    Indices const &indices, std::size_t mode,
+                    index_order order, bool last_only,
+                    std::size_t num_threads, F &&f) {
+  constexpr std::size_t R = Table::rank();
+  static_assert(R >= 1, "mdspan_cute::take/put: rank-0 operands");
+  static_assert(Other::rank() == R, "mdspan_cute::take/put: rank mismatch");
+  std::size_t const n = std::ranges::size(indices);
+  assert(mode < R);
+  assert(static_cast<std::size_t>(other.extent(mode)) == n);
+  for (std::size_t k = 0; k < R; ++k)
+    assert(k == mode || other.extent(k) == table.extent(k));
+  auto it = std::ranges::begin(indices);
+  for (std::size_t k = 0; k < n; ++k)
+    assert(!std::cmp_less(it[k], 0) &&
+           std::cmp_less(it[k], table.extent(mode)) &&
+           "mdspan_cute::take/put: index out of range");
+  if (n == 0 || table.size() == 0)
+    return;
+
+  auto const sched = index_schedule(table, indices, mode, order, last_only);
+  std::size_t const slice = table.size() / table.extent(mode);
+  parallel_for_chunks(sched.size(),
+                      threads_for(sched.size() * slice, num_threads),
+                      [&](std::size_t b, std::size_t e) {
+                        for (std::size_t p = b; p < e; ++p) {
+                          std::size_t const k = sched[p];
+                          f(k, static_cast<std::size_t>(it[k]));
+                        }
+                      });
+}
+
+} // namespace detail
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// take(src, indices, dst[, mode[, order[, num_threads]]])
+// dst[..., k, ...] = src[..., indices[k], ...]
+// ═══════════════════════════════════════════════════════════════════════════════
+
+template <class TS, class ES, class LS, class AS, detail::index_list Indices,
+          class TD, class ED, class LD, class AD>
+void take(std::mdspan<TS, ES, LS, AS> src, Indices const &indices,
+          std::mdspan<TD, ED, LD, AD> dst, std::size_t mode = 0,
+          index_order order = index_order::as_given,
+          std::size_t num_threads = default_num_threads()) {
+  detail::indexed_slices(src, dst, indices, mode, order, false, num_threads,
+                         [&](std::size_t k, std::size_t i) {
+                           detail::copy_slice(dst, src, mode, k, i);
+                         });
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// put(dst, indices, src[, mode[, order[, num_threads]]])
+// dst[..., indices[k], ...] = src[..., k, ...]; the last repeat wins
+// ═══════════════════════════════════════════════════════════════════════════════
+
+template <class TD, class ED, class LD, class AD, detail::index_list Indices,
+          class TS, class ES, class LS, class AS>
+void put(std::mdspan<TD, ED, LD, AD> dst, Indices const &indices,
+         std::mdspan<TS, ES, LS, AS> src, std::size_t mode = 0,
+         index_order order = index_order::as_given,
+         std::size_t num_threads = default_num_threads()) {
+  detail::indexed_slices(dst, src, indices, mode, order, true, num_threads,
+                         [&](std::size_t k, std::size_t i) {
+                           detail::copy_slice(dst, src, mode, i, k);
+                         });
+}
+
+} // namespace mdspan_cute
@@ -0,0 +1,98 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// Copyright 2026 Weyl AI
+//
+// mdspan_cute/index_space.h
+//
+// Coordinate-space helpers shared by the iteration utilities. Coordinates are
+// held as std::array<index_type, rank> and resolved to offsets through the
+// mdspan mapping, so every layout_cute layout (strided, swizzled, composed)
+// goes through the same cute function that operator[] uses.
+
+#pragma once
+
+#include <mdspan_cute/layout_cute.h>
+
+#include <array>
+#include <cstddef>
+#include <utility>
+
+namespace mdspan_cute {
+
+// A full coordinate for an mdspan with the given extents
+template <class Extents>
+using index_array =
+    std::array<typename Extents::index_type, Extents::rank()>;
+
+// ═══════════════════════════════════════════════════════════════════════════════
+namespace detail {
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Evaluate a mapping at an array coordinate
+// ─────────────────────────────────────────────────────────────────────────────
+
+template <class Mapping, class Index, std::size_t R>
+[[nodiscard]] constexpr auto offset_at(Mapping const &m,
+                                       std::array<Index, R> const &c) ->
+    typename Mapping::index_type {
+  return [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+    return m(c[Is]...);
+  }(std::make_index_sequence<R>{});
+}
+
+// Reference to the element at an array coordinate (goes through the accessor)
+template <class MDSpan, class Index, std::size_t R>
+[[nodiscard]] constexpr auto element_at(MDSpan const &md,
+                                        std::array<Index, R> const &c) ->
+    typename MDSpan::reference {
+  return md.accessor().access(md.data_handle(),
+                              static_cast<std::size_t>(
+                                  offset_at(md.mapping(), c)));
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Nested loops over the half-open box [lo, hi)
+// Mode 0 is outermost, mode R-1 innermost (mdspan / row-major order)
+// ─────────────────────────────────────────────────────────────────────────────
+
+template <std::size_t K = 0, class Index, std::size_t R, class F>
+constexpr void for_each_in_box(std::array<Index, R> const &lo,
+                               std::array<Index, R> const &hi,
+                               std::array<Index, R> &c, F &f) {
+  if constexpr (K == R) {
+    f(std::as_const(c));
+  } else {
+    for (c[K] = lo[K]; c[K] < hi[K]; ++c[K])
+      for_each_in_box<K + 1>(lo, hi, c, f);
+  }
+}
+
+// Extents type make_mdspan derives from a cute layout's flattened shape
+template <class CuteLayout>
+using layout_cute_extents_t =
+    cute_to_extents_t<std::size_t, shape_flatten_t<cute_shape_t<CuteLayout>>>;
+
+// Runtime extents as an array
+template <class Extents>
+[[nodiscard]] constexpr auto extents_array(Extents const &exts)
+    -> index_array<Extents> {
+  index_array<Extents> e{};
+  for (std::size_t k = 0; k < Extents::rank(); ++k)
+    e[k] = exts.extent(k);
+  return e;
+}
+
+} // namespace detail
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// for_each_index: visit every coordinate of an extents object in logical order
+// ═══════════════════════════════════════════════════════════════════════════════
+
+template <class Extents, class F>
+constexpr void for_each_index(Extents const &exts, F &&f) {
+  index_array<Extents> lo{};
+  index_array<Extents> c{};
+  auto const hi = detail::extents_array(exts);
+  detail::for_each_in_box(lo, hi, c, f);
+}
+
+} // namespace mdspan_cute
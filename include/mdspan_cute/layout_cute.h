@@ -12,10 +12,12 @@
 // GCC 15 / CUDA compatibility - must come before cute headers
 #include <mdspan_cute/cuda_gcc15_compat.h>
 
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <concepts>
 #include <cstddef>
+#include <cstdint>
 #include <experimental/mdspan>
 #include <type_traits>
 #include <utility>
@@ -278,6 +280,136 @@ template <typename CuteLayout>
 inline constexpr std::size_t cute_layout_flat_rank_v =
     cute::tuple_size<std::remove_cvref_t<shape_flatten_t<cute_shape_t<CuteLayout>>>>::value;
 
+// ─────────────────────────────────────────────────────────────────────────────
+// Uniqueness (injectivity) of cute layouts
+// Broadcast (stride 0) and overlapping strides (sliding windows) map several
+// coordinates to one offset. Affine layouts are decided from their strides
+// where possible. Offset functors composed over a layout (curves, rings, page
+// tables) vouch for themselves through is_injective(). Anything else is
+// unknown, which is_unique() reports as false: mdspan allows a conservative
+// answer, and enumerating offsets would allocate on every call.
+// ─────────────────────────────────────────────────────────────────────────────
+
+enum class uniqueness { unique, not_unique, unknown };
+
+// Decide from (extent, stride) pairs: a stride-0 or pigeonholed (cosize <
+// size) layout overlaps; strides that nest (each at least the span of all
+// smaller ones) are injective. Everything else needs enumeration.
+template <std::size_t R>
+constexpr auto affine_uniqueness(std::array<std::size_t, R> ext,
+                                 std::array<std::ptrdiff_t, R> stride)
+    -> uniqueness {
+  std::array<std::size_t, R> abs{};
+  std::size_t size = 1, span = 1;
+  for (std::size_t k = 0; k < R; ++k) {
+    abs[k] = static_cast<std::size_t>(stride[k] < 0 ? -stride[k] : stride[k]);
+    if (ext[k] == 0)
+      return uniqueness::unique;
+    if (ext[k] > 1 && abs[k] == 0)
+      return uniqueness::not_unique;
+    size *= ext[k];
+    span += (ext[k] - 1) * abs[k];
+  }
+  if (span < size)
+    return uniqueness::not_unique;
+
+  std::array<std::size_t, R> order{};
+  for (std::size_t k = 0; k < R; ++k)
+    order[k] = k;
+  std::sort(order.begin(), order.end(),
+            [&](std::size_t a, std::size_t b) { return abs[a] < abs[b]; });
+  std::size_t inner = 1; // span of the modes sorted so far
+  for (std::size_t k : order) {
+    if (ext[k] == 1)
+      continue;
+    if (abs[k] < inner)
+      return uniqueness::unknown;
+    inner += (ext[k] - 1) * abs[k];
+  }
+  return uniqueness::unique;
+}
+
+// Offset functor that knows whether it is injective on the offsets of the
+// layout it is composed over
+template <class F>
+concept injectivity_aware = requires(F const &f) {
+  { f.is_injective() } noexcept -> std::convertible_to<bool>;
+};
+
+// Stride-level verdict; unknown for layouts without plain strides
+template <class L> constexpr auto stride_uniqueness(L const &) -> uniqueness {
+  return uniqueness::unknown;
+}
+
+template <class Shape, class Stride>
+constexpr auto stride_uniqueness(cute::Layout<Shape, Stride> const &l)
+    -> uniqueness {
+  auto const shape = flatten_shape(cute::shape(l));
+  auto const stride = flatten_shape(cute::stride(l));
+  constexpr std::size_t R = cute::tuple_size<
+      std::remove_cvref_t<decltype(shape)>>::value;
+  std::array<std::size_t, R> e{};
+  std::array<std::ptrdiff_t, R> s{};
+  [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+    ((e[Is] = to_size_t(cute::get<Is>(shape)),
+      s[Is] = static_cast<std::ptrdiff_t>(cute::get<Is>(stride))),
+     ...);
+  }(std::make_index_sequence<R>{});
+  return affine_uniqueness(e, s);
+}
+
+// A swizzle is a bijection on offsets, so a swizzled layout is unique
+// exactly when the layout it is composed with is
+template <int B, int M, int S, class Offset, class Inner>
+constexpr auto stride_uniqueness(
+    cute::ComposedLayout<cute::Swizzle<B, M, S>, Offset, Inner> const &l)
+    -> uniqueness {
+  return stride_uniqueness(l.layout_b());
+}
+
+template <injectivity_aware F, class Offset, class Inner>
+constexpr auto
+stride_uniqueness(cute::ComposedLayout<F, Offset, Inner> const &l)
+    -> uniqueness {
+  return l.layout_a().is_injective() ? stride_uniqueness(l.layout_b())
+                                     : uniqueness::not_unique;
+}
+
+// Runtime verdict; unknown counts as not unique. No allocation.
+template <class L> constexpr bool layout_is_unique(L const &l) noexcept {
+  return stride_uniqueness(l) == uniqueness::unique;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Span of layouts whose offset functor reaches past the inner layout's
+// cosize (page tables): the functor reports it through span_size()
+// ─────────────────────────────────────────────────────────────────────────────
+
+template <class F>
+concept span_aware = requires(F const &f) {
+  { f.span_size() } noexcept -> std::convertible_to<std::int64_t>;
+};
+
+template <class L>
+concept functor_span_layout = requires(L const &l) {
+  requires span_aware<std::remove_cvref_t<decltype(l.layout_a())>>;
+};
+
+template <class L> constexpr auto layout_span(L const &l) noexcept {
+  if constexpr (functor_span_layout<L>)
+    return static_cast<std::int64_t>(l.layout_a().span_size());
+  else
+    return cute::cosize(l);
+}
+
+// Compile-time verdict for static layouts; never enumerates
+template <class L> constexpr bool layout_always_unique() {
+  if constexpr (std::is_empty_v<L>)
+    return stride_uniqueness(L{}) == uniqueness::unique;
+  else
+    return false;
+}
+
 } // namespace detail
 
 // ═══════════════════════════════════════════════════════════════════════════════
@@ -368,11 +500,12 @@ template <cute_layout CuteLayout> struct layout_cute {
       return cute_layout_;
     }
 
-    // required_span_size: use cute's cosize for non-contiguous layouts
+    // required_span_size: use cute's cosize for non-contiguous layouts, or
+    // the offset functor's span where it provides one
     // Returns size_type per mdspan mapping requirements
     [[nodiscard]] constexpr auto required_span_size() const noexcept
         -> size_type {
-      return static_cast<size_type>(cute::cosize(cute_layout_));
+      return static_cast<size_type>(detail::layout_span(cute_layout_));
     }
 
     // ─────────────────────────────────────────────────────────────────────
@@ -414,8 +547,10 @@ template <cute_layout CuteLayout> struct layout_cute {
     // ─────────────────────────────────────────────────────────────────────
     // Layout mapping properties
     // ─────────────────────────────────────────────────────────────────────
+    // Unique when no two indices share an offset; broadcast and overlapping
+    // layouts are not. Only static layouts can be unique for every value.
     [[nodiscard]] static constexpr bool is_always_unique() noexcept {
-      return true;
+      return detail::layout_always_unique<CuteLayout>();
     }
     [[nodiscard]] static constexpr bool is_always_exhaustive() noexcept {
       return false;
@@ -430,9 +565,20 @@ template <cute_layout CuteLayout> struct layout_cute {
       return false;
     }
 
-    [[nodiscard]] constexpr bool is_unique() const noexcept { return true; }
+    // Decided from the strides or the offset functor; false when neither
+    // settles it
+    [[nodiscard]] constexpr bool is_unique() const noexcept {
+      if constexpr (is_always_unique())
+        return true;
+      else
+        return detail::layout_is_unique(cute_layout_);
+    }
+    // Functor spans (page tables) may leave holes: conservatively false
     [[nodiscard]] constexpr bool is_exhaustive() const noexcept {
-      return cute::size(cute_layout_) == cute::cosize(cute_layout_);
+      if constexpr (detail::functor_span_layout<CuteLayout>)
+        return false;
+      else
+        return cute::size(cute_layout_) == cute::cosize(cute_layout_);
     }
 
     // is_contiguous() - conservative default
@@ -574,6 +720,35 @@ template <typename SwizzleType, typename Shape>
 
 } // namespace swizzle
 
+// ═══════════════════════════════════════════════════════════════════════════════
+// Packing Presets
+// K-interleaved ("VNNI") operand layouts for dot-product instructions that
+// reduce KP adjacent K values per 32-bit lane: pairs for bf16/fp16
+// (AVX512-BF16, AMX-BF16), quads for int8 (AVX512-VNNI, AMX-INT8).
+// ═══════════════════════════════════════════════════════════════════════════════
+
+namespace packing {
+
+// K values per 32-bit lane for element type T
+template <typename T>
+inline constexpr int vnni_factor = static_cast<int>(4 / sizeof(T));
+
+// (K, N) operand with K split into groups of KP:
+//   ((KP, ⌈K/KP⌉), N) : ((1, N·KP), KP)
+// so element (k, n) lives at (k / KP) · N · KP + n · KP + k mod KP. The
+// last group is padded to KP; cosize covers the padding. As an mdspan the
+// K mode flattens to (k mod KP, k / KP, n).
+template <int KP, typename K, typename N>
+[[nodiscard]] constexpr auto make_vnni_layout(K const &k, N const &n) {
+  static_assert(KP > 0, "mdspan_cute::make_vnni_layout: KP must be positive");
+  auto const kp = cute::Int<KP>{};
+  return cute::make_layout(
+      cute::make_shape(cute::make_shape(kp, cute::ceil_div(k, kp)), n),
+      cute::make_stride(cute::make_stride(cute::Int<1>{}, n * kp), kp));
+}
+
+} // namespace packing
+
 // ═══════════════════════════════════════════════════════════════════════════════
 // Convenience Type Aliases
 // ═══════════════════════════════════════════════════════════════════════════════
@@ -0,0 +1,197 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// Copyright 2026 Weyl AI
+//
+// mdspan_cute/loop_order.h
+//
+// Physical loop ordering for layout_cute mdspans.
+//
+// Logical order (mode 0 outermost) is a poor loop order for cute layouts:
+// column-major, transposed and hierarchical layouts put the unit stride on an
+// arbitrary mode. These helpers read the per-mode strides of a mapping (exact
+// when the mapping is strided, probed from unit steps otherwise, e.g. for
+// swizzles) and drive a loop nest whose innermost mode is the one with the
+// smallest stride.
+
+#pragma once
+
+#include <mdspan_cute/index_space.h>
+#include <mdspan_cute/layout_cute.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace mdspan_cute {
+
+// Per-mode distance in elements between neighbouring coordinates
+template <std::size_t Rank> using stride_array = std::array<std::size_t, Rank>;
+
+// A permutation of modes, outermost first
+template <std::size_t Rank> using mode_order = std::array<std::size_t, Rank>;
+
+// ═══════════════════════════════════════════════════════════════════════════════
+namespace detail {
+
+template <class Mapping>
+concept mapping_with_stride =
+    requires(Mapping const &m) { m.stride(typename Mapping::rank_type{}); };
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Plain cute::Layout with a flat shape: offset is Σ c_k · get<k>(stride)
+// (swizzles and other composed layouts are not affine)
+// ─────────────────────────────────────────────────────────────────────────────
+
+template <class T>
+inline constexpr bool is_flat_int_tuple_v = !cute::is_tuple<T>::value;
+
+template <class... Ts>
+inline constexpr bool is_flat_int_tuple_v<cute::tuple<Ts...>> =
+    (!cute::is_tuple<Ts>::value && ...);
+
+template <class L> struct is_flat_cute_layout : std::false_type {};
+
+template <class Shape, class Stride>
+struct is_flat_cute_layout<cute::Layout<Shape, Stride>>
+    : std::bool_constant<is_flat_int_tuple_v<Shape> &&
+                         is_flat_int_tuple_v<Stride>> {};
+
+template <class Policy> struct cute_layout_of {};
+
+template <class CuteLayout> struct cute_layout_of<layout_cute<CuteLayout>> {
+  using type = CuteLayout;
+};
+
+template <class Mapping>
+concept flat_cute_mapping = requires {
+  typename cute_layout_of<typename Mapping::layout_type>::type;
+} && is_flat_cute_layout<typename cute_layout_of<
+         typename Mapping::layout_type>::type>::value;
+
+template <class V> constexpr std::ptrdiff_t to_ptrdiff(V const &v) {
+  return static_cast<std::ptrdiff_t>(v);
+}
+
+// Exact signed strides when the mapping is affine
+template <class Mapping>
+[[nodiscard]] constexpr auto affine_strides(Mapping const &m)
+    -> std::optional<std::array<std::ptrdiff_t, Mapping::extents_type::rank()>> {
+  constexpr std::size_t R = Mapping::extents_type::rank();
+  std::array<std::ptrdiff_t, R> s{};
+  if constexpr (flat_cute_mapping<Mapping>) {
+    auto const flat = flatten_shape(cute::stride(m.cute_layout()));
+    [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+      ((s[Is] = to_ptrdiff(cute::get<Is>(flat))), ...);
+    }(std::make_index_sequence<R>{});
+    return s;
+  } else if constexpr (mapping_with_stride<Mapping>) {
+    if (!m.is_strided())
+      return std::nullopt;
+    for (std::size_t k = 0; k < R; ++k)
+      s[k] = static_cast<std::ptrdiff_t>(
+          m.stride(static_cast<typename Mapping::rank_type>(k)));
+    return s;
+  } else {
+    return std::nullopt;
+  }
+}
+
+// True when offset(c) = offset(0) + Σ c_k · stride(k) holds exactly
+template <class Mapping>
+[[nodiscard]] constexpr bool is_affine(Mapping const &m) noexcept {
+  return affine_strides(m).has_value();
+}
+
+} // namespace detail
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// mode_strides: exact strides for strided mappings, unit-step probes otherwise
+// Modes of extent 1 report the maximum stride so they sort outermost.
+// ═══════════════════════════════════════════════════════════════════════════════
+
+template <class Mapping>
+[[nodiscard]] constexpr auto mode_strides(Mapping const &m)
+    -> stride_array<Mapping::extents_type::rank()> {
+  using index_type = typename Mapping::index_type;
+  constexpr std::size_t R = Mapping::extents_type::rank();
+
+  stride_array<R> s{};
+  auto const magnitude = [](auto v) {
+    return static_cast<std::size_t>(v < 0 ? -v : v);
+  };
+
+  std::array<index_type, R> zero{};
+  auto const origin =
+      static_cast<std::ptrdiff_t>(detail::offset_at(m, zero));
+  auto const affine = detail::affine_strides(m);
+
+  for (std::size_t k = 0; k < R; ++k) {
+    if (m.extents().extent(k) <= 1) {
+      s[k] = std::numeric_limits<std::size_t>::max();
+      continue;
+    }
+    if (affine) {
+      s[k] = magnitude((*affine)[k]);
+      continue;
+    }
+    auto c = zero;
+    c[k] = 1;
+    s[k] = magnitude(static_cast<std::ptrdiff_t>(detail::offset_at(m, c)) -
+                     origin);
+  }
+  return s;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// stride_order: modes sorted by descending stride (innermost = smallest)
+// Equal strides keep logical order, so layout_right maps to the identity.
+// ═══════════════════════════════════════════════════════════════════════════════
+
+template <std::size_t R>
+[[nodiscard]] constexpr auto stride_order(stride_array<R> const &s)
+    -> mode_order<R> {
+  mode_order<R> order{};
+  std::iota(order.begin(), order.end(), std::size_t{0});
+  // Insertion sort: stable, constexpr, and R is tiny
+  for (std::size_t i = 1; i < R; ++i)
+    for (std::size_t j = i; j > 0 && s[order[j - 1]] < s[order[j]]; --j)
+      std::swap(order[j - 1], order[j]);
+  return order;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+namespace detail {
+
+// ─────────────────────────────────────────────────────────────────────────────
+// for_each_run: loop every mode but the innermost in the given order and call
+// f(c) once per innermost run, with c[order[R-1]] = lo[order[R-1]]. The
+// caller owns the innermost loop so it can use pointer strides / SIMD.
+// ─────────────────────────────────────────────────────────────────────────────
+
+template <class Index, std::size_t R, class F>
+constexpr void for_each_run(std::array<Index, R> const &lo,
+                            std::array<Index, R> const &hi,
+                            mode_order<R> const &order,
+                            std::array<Index, R> &c, F &f,
+                            std::size_t depth = 0) {
+  static_assert(R > 0, "mdspan_cute::for_each_run: rank-0 has no runs");
+  if (depth + 1 == R) {
+    auto const inner = order[R - 1];
+    if (lo[inner] < hi[inner]) {
+      c[inner] = lo[inner];
+      f(std::as_const(c));
+    }
+    return;
+  }
+  auto const k = order[depth];
+  for (c[k] = lo[k]; c[k] < hi[k]; ++c[k])
+    for_each_run(lo, hi, order, c, f, depth + 1);
+}
+
+} // namespace detail
+
+} // namespace mdspan_cute
@@ -0,0 +1,200 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// Copyright 2026 Weyl AI
+//
+// mdspan_cute/mdarray.h
+//
+// Owning multidimensional array over a cute layout (P1684 mdarray style).
+//
+//   // Fully static layout: inline std::array of cosize elements, no heap
+//   mdspan_cute::cute_mdarray<float, decltype(swizzled_8x8)> acc;
+//   acc[r, c] += a * b;
+//
+//   // Dynamic layout: std::vector with a pluggable allocator
+//   mdspan_cute::cute_mdarray<float, decltype(layout)> tile(layout);
+//
+//   cute_mdspan<float, L> view = acc; // implicit conversion to the view
+//
+// Storage holds exactly cosize(layout) elements, so padded and swizzled
+// layouts own every slot they can address. Copies are deep.
+
+#pragma once
+
+#include <mdspan_cute/index_space.h>
+#include <mdspan_cute/layout_cute.h>
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <cute/layout.hpp>
+
+namespace mdspan_cute {
+
+// ═══════════════════════════════════════════════════════════════════════════════
+namespace detail {
+
+template <class T, class CuteLayout, class Alloc> struct mdarray_storage {
+  using type = std::vector<T, Alloc>;
+};
+
+template <class T, cute_static_layout CuteLayout, class Alloc>
+struct mdarray_storage<T, CuteLayout, Alloc> {
+  static constexpr std::size_t cosize =
+      static_cast<std::size_t>(cute::cosize(CuteLayout{}));
+  using type = std::array<T, cosize>;
+};
+
+} // namespace detail
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// cute_mdarray<T, CuteLayout, Alloc>
+// ═══════════════════════════════════════════════════════════════════════════════
+
+template <class T, cute_layout CuteLayout, class Alloc = std::allocator<T>>
+class cute_mdarray {
+public:
+  using element_type = T;
+  using value_type = T;
+  using layout_type = layout_cute<CuteLayout>;
+  using extents_type = detail::layout_cute_extents_t<CuteLayout>;
+  using mapping_type = typename layout_type::template mapping<extents_type>;
+  using index_type = typename extents_type::index_type;
+  using size_type = typename extents_type::size_type;
+  using rank_type = typename extents_type::rank_type;
+  using container_type =
+      typename detail::mdarray_storage<T, CuteLayout, Alloc>::type;
+  using mdspan_type = std::mdspan<T, extents_type, layout_type>;
+  using const_mdspan_type = std::mdspan<T const, extents_type, layout_type>;
+  using reference = T &;
+  using const_reference = T const &;
+
+  static constexpr bool is_inline = cute_static_layout<CuteLayout>;
+
+  // ─────────────────────────────────────────────────────────────────────
+  // Construction: elements are value-initialized
+  // ─────────────────────────────────────────────────────────────────────
+
+  constexpr cute_mdarray()
+    requires is_inline
+      : map_(CuteLayout{}), ctr_{} {}
+
+  constexpr explicit cute_mdarray(CuteLayout const &layout)
+    requires is_inline
+      : map_(layout), ctr_{} {}
+
+  explicit cute_mdarray(CuteLayout const &layout, Alloc const &alloc = {})
+    requires(!is_inline)
+      : map_(layout),
+        ctr_(static_cast<std::size_t>(map_.required_span_size()), T{},
+             alloc) {}
+
+  // Every storage slot set to `value`
+  constexpr cute_mdarray(CuteLayout const &layout, T const &value)
+    requires is_inline
+      : map_(layout), ctr_{} {
+    ctr_.fill(value);
+  }
+
+  cute_mdarray(CuteLayout const &layout, T const &value,
+               Alloc const &alloc = {})
+    requires(!is_inline)
+      : map_(layout),
+        ctr_(static_cast<std::size_t>(map_.required_span_size()), value,
+             alloc) {}
+
+  // ─────────────────────────────────────────────────────────────────────
+  // Views
+  // ─────────────────────────────────────────────────────────────────────
+
+  [[nodiscard]] constexpr auto to_mdspan() noexcept -> mdspan_type {
+    return mdspan_type(ctr_.data(), map_);
+  }
+  [[nodiscard]] constexpr auto to_mdspan() const noexcept
+      -> const_mdspan_type {
+    return const_mdspan_type(ctr_.data(), map_);
+  }
+
+  constexpr operator mdspan_type() noexcept { return to_mdspan(); }
+  constexpr operator const_mdspan_type() const noexcept { return to_mdspan(); }
+
+  // ─────────────────────────────────────────────────────────────────────
+  // Element access (goes through the cute layout, like the view)
+  // ─────────────────────────────────────────────────────────────────────
+
+  template <class... Indices>
+    requires(sizeof...(Indices) == extents_type::rank())
+  [[nodiscard]] constexpr auto operator[](Indices... idx) -> reference {
+    return ctr_[offset(idx...)];
+  }
+
+  template <class... Indices>
+    requires(sizeof...(Indices) == extents_type::rank())
+  [[nodiscard]] constexpr auto operator[](Indices... idx) const
+      -> const_reference {
+    return ctr_[offset(idx...)];
+  }
+
+  // ─────────────────────────────────────────────────────────────────────
+  // Observers
+  // ─────────────────────────────────────────────────────────────────────
+
+  [[nodiscard]] static constexpr auto rank() noexcept -> rank_type {
+    return extents_type::rank();
+  }
+  [[nodiscard]] constexpr auto extents() const noexcept
+      -> extents_type const & {
+    return map_.extents();
+  }
+  [[nodiscard]] constexpr auto extent(rank_type r) const noexcept
+      -> index_type {
+    return map_.extents().extent(r);
+  }
+  [[nodiscard]] constexpr auto mapping() const noexcept
+      -> mapping_type const & {
+    return map_;
+  }
+  [[nodiscard]] constexpr auto cute_layout() const noexcept
+      -> CuteLayout const & {
+    return map_.cute_layout();
+  }
+
+  // Logical element count (product of extents)
+  [[nodiscard]] constexpr auto size() const noexcept -> size_type {
+    size_type n = 1;
+    for (rank_type r = 0; r < rank(); ++r)
+      n *= static_cast<size_type>(extent(r));
+    return n;
+  }
+
+  // Storage: cosize(layout) elements
+  [[nodiscard]] constexpr auto container_size() const noexcept
+      -> std::size_t {
+    return ctr_.size();
+  }
+  [[nodiscard]] constexpr auto data() noexcept -> T * { return ctr_.data(); }
+  [[nodiscard]] constexpr auto data() const noexcept -> T const * {
+    return ctr_.data();
+  }
+  [[nodiscard]] constexpr auto container() const noexcept
+      -> container_type const & {
+    return ctr_;
+  }
+
+private:
+  template <class... Indices>
+  [[nodiscard]] constexpr auto offset(Indices... idx) const noexcept
+      -> std::size_t {
+    return static_cast<std::size_t>(map_(static_cast<index_type>(idx)...));
+  }
+
+  [[no_unique_address]] mapping_type map_;
+  container_type ctr_;
+};
+
+template <cute_layout CuteLayout, class T>
+cute_mdarray(CuteLayout const &, T const &) -> cute_mdarray<T, CuteLayout>;
+
+} // namespace mdspan_cute
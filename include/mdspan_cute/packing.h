@@ -0,0 +1,82 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// Copyright 2026 Weyl AI
+//
+// mdspan_cute/packing.h
+//
+// Packers for the k-interleaved operand layouts in packing:: (layout_cute.h).
+//
+//   std::vector<std::int8_t> packed(cute::cosize(
+//       mdspan_cute::packing::make_vnni_layout<4>(k, n)));
+//   auto p = mdspan_cute::pack_vnni(b, packed.data()); // b: (k, n) row-major
+//   // p[r, g, j] == b[4 * g + r, j]; rows past k are zero
+//
+// The source is viewed as (KP, K/KP, N) over its own buffer and copied into
+// the packed layout with permute_copy, whose tiling handles the stride
+// mismatch between the two (N-contiguous in, KP-contiguous out). A K that is
+// not a multiple of KP leaves a partial last group, which is filled
+// separately and zero-padded.
+
+#pragma once
+
+#include <mdspan_cute/layout_cute.h>
+#include <mdspan_cute/parallel.h>
+#include <mdspan_cute/permute.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+
+#include <cute/layout.hpp>
+
+namespace mdspan_cute {
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// pack_vnni<KP>(src, dst[, num_threads])
+// src is a row-major (K, N) matrix; dst holds cosize(make_vnni_layout<KP>(K,
+// N)) elements. Returns the packed (KP, ⌈K/KP⌉, N) view of dst. KP defaults
+// to packing::vnni_factor of the element type.
+// ═══════════════════════════════════════════════════════════════════════════════
+
+template <int KP, class T, class E, class A>
+auto pack_vnni(std::mdspan<T, E, std::layout_right, A> src,
+               std::remove_const_t<T> *dst,
+               std::size_t num_threads = default_num_threads()) {
+  static_assert(E::rank() == 2,
+                "mdspan_cute::pack_vnni: source must be a (K, N) matrix");
+  auto const k = static_cast<std::int64_t>(src.extent(0));
+  auto const n = static_cast<std::int64_t>(src.extent(1));
+  auto const kp = cute::Int<KP>{};
+  auto const packed = make_mdspan(dst, packing::make_vnni_layout<KP>(k, n));
+
+  // Whole groups: src viewed as (KP, K/KP, N) → same coordinates in dst
+  std::int64_t const groups = k / KP;
+  if (groups > 0) {
+    auto const in = make_mdspan(
+        src.data_handle(),
+        cute::make_layout(cute::make_shape(kp, groups, n),
+                          cute::make_stride(n, n * KP, cute::Int<1>{})));
+    auto const out =
+        make_mdspan(dst, packing::make_vnni_layout<KP>(groups * KP, n));
+    permute_copy(in, out, {0, 1, 2}, std::identity{}, num_threads);
+  }
+
+  // Partial last group, zero-padded
+  if (std::int64_t const tail = k - groups * KP; tail > 0)
+    for (std::int64_t j = 0; j < n; ++j)
+      for (std::int64_t r = 0; r < KP; ++r)
+        packed[r, groups, j] = r < tail
+                                   ? src[groups * KP + r, j]
+                                   : std::remove_const_t<T>{};
+  return packed;
+}
+
+template <class T, class E, class A>
+auto pack_vnni(std::mdspan<T, E, std::layout_right, A> src,
+               std::remove_const_t<T> *dst,
+               std::size_t num_threads = default_num_threads()) {
+  return pack_vnni<packing::vnni_factor<std::remove_const_t<T>>>(
+      src, dst, num_threads);
+}
+
+} // namespace mdspan_cute
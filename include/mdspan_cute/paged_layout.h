@@ -0,0 +1,193 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// Copyright 2026 Weyl AI
+//
+// mdspan_cute/paged_layout.h
+//
+// Paged (block-table) layouts for KV-cache style storage.
+//
+//   // block_table[seq * max_blocks + b] = physical page of block b of seq
+//   auto layout = mdspan_cute::make_paged_layout(
+//       block_table, num_seqs, max_blocks, page_size,
+//       cute::make_shape(heads, head_dim));
+//   auto kv = mdspan_cute::make_mdspan(pool, layout);
+//   kv[seq, pos, head, dim] = x;       // one table load per access
+//
+//   // Hot loops: resolve each page once, then index a dense page view
+//   mdspan_cute::for_each_page(kv, [](auto seq, auto block, auto page) {
+//     page[slot, head, dim] ...;       // (page_size, heads, head_dim)
+//   });
+//
+// The position mode is split into logical blocks of page_size tokens and
+// each block is looked up in a page table. As with swizzles and curves
+// (curve_layouts.h) the layout is a cute ComposedLayout: a dense row-major
+// logical layout over (seq, pos, token modes...) followed by paged_fn, which
+// maps the logical offset L to
+//
+//   table[L / page_elems] · page_elems + L mod page_elems
+//
+// where page_elems = page_size · size(token shape) is one physical page. A
+// page is therefore contiguous, ordered (slot, token modes...) row-major, and
+// pages live anywhere in the pool at multiples of page_elems.
+//
+// make_paged_layout scans the table once. The mapping's required_span_size
+// then runs to the end of the highest page referenced, so the pool must
+// hold at least that many pages. is_unique() holds exactly when no page is
+// referenced twice, and is_exhaustive() is false (pages may be unused).
+// Negative entries mark unallocated blocks: they are skipped by
+// for_each_page and must not be accessed. Build a new layout after editing
+// the table so that span and uniqueness stay current.
+
+#pragma once
+
+#include <mdspan_cute/layout_cute.h>
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include <cute/layout.hpp>
+
+namespace mdspan_cute {
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// paged_fn: logical offset → physical offset through a block table
+// ═══════════════════════════════════════════════════════════════════════════════
+
+struct paged_fn {
+  std::int32_t const *table = nullptr; // physical page per logical block
+  std::int64_t blocks_per_seq = 1;     // row length of the table
+  std::int64_t page_size = 1;          // tokens per page
+  std::int64_t page_elems = 1;         // elements per page
+  int page_shift = -1;                 // log2(page_elems) when a power of 2
+  std::int64_t span_pages = 0;         // 1 + largest table entry
+  bool distinct_pages = true;          // no page referenced twice
+
+  constexpr paged_fn() = default;
+
+  constexpr paged_fn(std::int32_t const *t, std::int64_t blocks,
+                     std::int64_t tokens, std::int64_t elems) noexcept
+      : table(t), blocks_per_seq(blocks), page_size(tokens),
+        page_elems(elems),
+        page_shift(std::has_single_bit(static_cast<std::uint64_t>(elems))
+                       ? std::countr_zero(static_cast<std::uint64_t>(elems))
+                       : -1) {}
+
+  template <class I>
+  [[nodiscard]] constexpr auto operator()(I const &offset) const noexcept
+      -> std::int64_t {
+    auto const l = static_cast<std::int64_t>(offset);
+    std::int64_t block, within;
+    if (page_shift >= 0) {
+      block = l >> page_shift;
+      within = l & (page_elems - 1);
+    } else {
+      block = l / page_elems;
+      within = l % page_elems;
+    }
+    std::int64_t const page = table[block];
+    assert(page >= 0 && "mdspan_cute::paged_fn: unallocated block");
+    return page * page_elems + within;
+  }
+
+  // Record span and distinctness of the first `entries` table entries
+  constexpr void scan_table(std::int64_t entries) {
+    std::int64_t top = -1;
+    for (std::int64_t i = 0; i < entries; ++i)
+      top = std::max<std::int64_t>(top, table[i]);
+    span_pages = top + 1;
+    std::vector<bool> seen(static_cast<std::size_t>(span_pages));
+    distinct_pages = true;
+    for (std::int64_t i = 0; i < entries; ++i)
+      if (std::int64_t const page = table[i]; page >= 0) {
+        distinct_pages = distinct_pages && !seen[std::size_t(page)];
+        seen[std::size_t(page)] = true;
+      }
+  }
+
+  // Hooks read by layout_cute (required_span_size, is_unique)
+  [[nodiscard]] constexpr auto span_size() const noexcept -> std::int64_t {
+    return span_pages * page_elems;
+  }
+  [[nodiscard]] constexpr bool is_injective() const noexcept {
+    return distinct_pages;
+  }
+
+  friend constexpr bool operator==(paged_fn const &,
+                                   paged_fn const &) = default;
+};
+
+// Cute layouts produced by make_paged_layout
+template <class L>
+concept paged_cute_layout = requires(L const &l) {
+  requires std::same_as<std::remove_cvref_t<decltype(l.layout_a())>,
+                        paged_fn>;
+};
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// make_paged_layout(table, num_seqs, max_blocks, page_size, token_shape)
+// Shape (num_seqs, max_blocks · page_size, token modes...)
+// ═══════════════════════════════════════════════════════════════════════════════
+
+template <class TokenShape>
+[[nodiscard]] constexpr auto
+make_paged_layout(std::int32_t const *block_table, std::int64_t num_seqs,
+                  std::int64_t max_blocks, std::int64_t page_size,
+                  TokenShape const &token_shape) {
+  auto const tokens = detail::flatten_shape(token_shape);
+  auto const shape = cute::tuple_cat(
+      cute::make_shape(num_seqs, max_blocks * page_size), tokens);
+  auto const token_elems = static_cast<std::int64_t>(cute::size(tokens));
+  paged_fn fn(block_table, max_blocks, page_size, page_size * token_elems);
+  fn.scan_table(num_seqs * max_blocks);
+  return cute::composition(fn, cute::Int<0>{},
+                           cute::make_layout(shape, cute::LayoutRight{}));
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// for_each_page(kv, f): f(seq, block, page) for every allocated block
+// page is a dense (page_size, token modes...) row-major mdspan over the
+// physical page, so the table is read once per page. Pages are reached
+// through kv's accessor (offset()) and view it through its offset_policy.
+// ═══════════════════════════════════════════════════════════════════════════════
+
+template <class T, class E, class CuteLayout, class A, class F>
+  requires paged_cute_layout<CuteLayout>
+void for_each_page(std::mdspan<T, E, layout_cute<CuteLayout>, A> const &kv,
+                   F &&f) {
+  auto const &layout = kv.mapping().cute_layout();
+  paged_fn const &fn = layout.layout_a();
+  auto const full = cute::shape(layout.layout_b());
+  // (page_size, token modes...): drop (seq, pos) and prepend the slot mode
+  auto const page_shape = cute::tuple_cat(
+      cute::make_shape(fn.page_size),
+      cute::take<2, cute::tuple_size<std::remove_cvref_t<decltype(full)>>::
+                        value>(full));
+  auto const page_layout = cute::make_layout(page_shape, cute::LayoutRight{});
+  auto const page_mapping =
+      make_mdspan(static_cast<T *>(nullptr), page_layout).mapping();
+  using page_accessor = typename A::offset_policy;
+  using page_type =
+      std::mdspan<T, typename decltype(page_mapping)::extents_type,
+                  typename decltype(page_mapping)::layout_type, page_accessor>;
+  page_accessor const acc(kv.accessor());
+
+  auto const seqs = static_cast<std::int64_t>(kv.extent(0));
+  for (std::int64_t s = 0; s < seqs; ++s)
+    for (std::int64_t b = 0; b < fn.blocks_per_seq; ++b) {
+      std::int64_t const page = fn.table[s * fn.blocks_per_seq + b];
+      if (page < 0)
+        continue;
+      f(s, b,
+        page_type(kv.accessor().offset(
+                      kv.data_handle(),
+                      static_cast<std::size_t>(page * fn.page_elems)),
+                  page_mapping, acc));
+    }
+}
+
+} // namespace mdspan_cute
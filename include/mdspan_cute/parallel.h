@@ -0,0 +1,101 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// Copyright 2026 Weyl AI
+//
+// mdspan_cute/parallel.h
+//
+// Minimal fork-join helpers for the CPU engines. Work is split into
+// contiguous chunks of an index range, one std::jthread per chunk, with the
+// calling thread taking the last chunk. Small ranges stay on the caller.
+// run_workers spawns one thread per worker, optionally pinned to a core.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace mdspan_cute {
+
+// Elements of work below which an engine does not fork
+inline constexpr std::size_t parallel_grain = std::size_t{1} << 15;
+
+[[nodiscard]] inline auto default_num_threads() noexcept -> std::size_t {
+  return std::max(1u, std::thread::hardware_concurrency());
+}
+
+// Threads worth using for `work` elements, capped by `requested`
+[[nodiscard]] inline auto threads_for(std::size_t work,
+                                      std::size_t requested) noexcept
+    -> std::size_t {
+  std::size_t const useful = std::max<std::size_t>(1, work / parallel_grain);
+  return std::max<std::size_t>(1, std::min(useful, requested));
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// parallel_for_chunks: f(begin, end) over a partition of [0, n)
+// Chunk sizes differ by at most one; chunk i always covers the same range for
+// a given (n, num_threads), so results are deterministic.
+// ═══════════════════════════════════════════════════════════════════════════════
+
+template <class F>
+void parallel_for_chunks(std::size_t n, std::size_t num_threads, F &&f) {
+  std::size_t const chunks = std::min(std::max<std::size_t>(1, num_threads), n);
+  if (chunks <= 1) {
+    f(std::size_t{0}, n);
+    return;
+  }
+
+  auto const bounds = [&](std::size_t i) {
+    return std::min(n, (n / chunks) * i + std::min(i, n % chunks));
+  };
+
+  std::vector<std::jthread> workers;
+  workers.reserve(chunks - 1);
+  for (std::size_t i = 0; i + 1 < chunks; ++i)
+    workers.emplace_back([&f, b = bounds(i), e = bounds(i + 1)] { f(b, e); });
+  f(bounds(chunks - 1), n);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Core pinning
+// ═══════════════════════════════════════════════════════════════════════════════
+
+// Pin the calling thread to `core` (mod the core count). Linux only; returns
+// false where affinity is unsupported or refused.
+inline bool pin_current_thread(std::size_t core) noexcept {
+#if defined(__linux__)
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(static_cast<int>(core % default_num_threads()), &set);
+  return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+  (void)core;
+  return false;
+#endif
+}
+
+// f(worker) on `num_workers` dedicated threads; the caller only joins, so its
+// own affinity is never changed. A single unpinned worker runs inline.
+template <class F>
+void run_workers(std::size_t num_workers, bool pin, F &&f) {
+  if (num_workers <= 1 && !pin) {
+    f(std::size_t{0});
+    return;
+  }
+  std::vector<std::jthread> workers;
+  workers.reserve(num_workers);
+  for (std::size_t w = 0; w < num_workers; ++w)
+    workers.emplace_back([&f, w, pin] {
+      if (pin)
+        pin_current_thread(w);
+      f(w);
+    });
+}
+
+} // namespace mdspan_cute
@@ -0,0 +1,269 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// Copyright 2026 Weyl AI
+//
+// mdspan_cute/permute.h
+//
+// Cache-blocked, multithreaded permute/transpose copy between mdspans.
+//
+//   permute_copy(src, dst, {2, 0, 1});   // dst[i, j, k] = src[j, k, i]
+//   permute_copy(src, dst);              // layout conversion, same modes
+//
+// dst mode k reads src mode perm[k] (numpy transpose semantics), so
+// dst.extent(k) == src.extent(perm[k]).
+//
+// A logical-order copy between, say, a swizzled and a column-major layout
+// streams one side and strides the other. Instead the engine picks two dst
+// modes from the strides of both layouts: `b`, innermost in dst, and `a`,
+// innermost in src. The copy is tiled over (a, b) on two levels:
+//   L2 block   B×B, sized so a src and a dst block fit the block budget;
+//              blocks are the unit of work split across threads
+//   micro-tile 8×8 through a local buffer: read with `a` innermost, write
+//              with `b` innermost (the compiler turns the buffer transpose
+//              into register shuffles)
+// Affine operands use base + stride arithmetic inside a tile; other layouts
+// (swizzles) resolve each element through their mapping.
+//
+// Every element passes through `op` (default std::identity), so converting
+// copies reuse the same engine.
+
+#pragma once
+
+#include <mdspan_cute/index_space.h>
+#include <mdspan_cute/layout_cute.h>
+#include <mdspan_cute/loop_order.h>
+#include <mdspan_cute/parallel.h>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <numeric>
+#include <optional>
+#include <type_traits>
+
+namespace mdspan_cute {
+
+// Micro-tile edge (elements) and L2 block budget (bytes, src + dst)
+inline constexpr std::size_t permute_micro_tile = 8;
+inline constexpr std::size_t permute_block_bytes = std::size_t{256} << 10;
+
+// ═══════════════════════════════════════════════════════════════════════════════
+namespace detail {
+
+// L2 block edge: largest power-of-two multiple of the micro-tile with
+// B² · (sizeof src + sizeof dst) ≤ budget
+template <class TS, class TD>
+[[nodiscard]] constexpr auto permute_block_edge() noexcept -> std::size_t {
+  constexpr std::size_t bytes = sizeof(TS) + sizeof(TD);
+  std::size_t b = permute_micro_tile;
+  while ((2 * b) * (2 * b) * bytes <= permute_block_bytes && b < 1024)
+    b *= 2;
+  return b;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Plan: the two tiled dst modes and the outer modes
+// ─────────────────────────────────────────────────────────────────────────────
+
+template <std::size_t R> struct permute_plan {
+  std::size_t a = 0; // dst mode whose src mode is innermost in src
+  std::size_t b = 0; // innermost dst mode
+  std::array<std::size_t, R> outer{}; // remaining modes, fastest first
+  std::size_t outer_count = 0;
+};
+
+template <std::size_t R>
+[[nodiscard]] constexpr auto
+make_permute_plan(stride_array<R> const &dst_strides,
+                  stride_array<R> const &src_strides_in_dst_modes)
+    -> permute_plan<R> {
+  static_assert(R >= 2);
+  permute_plan<R> plan;
+  auto const dst_order = stride_order(dst_strides);
+  auto const src_order = stride_order(src_strides_in_dst_modes);
+  plan.b = dst_order[R - 1];
+  plan.a = src_order[R - 1];
+  if (plan.a == plan.b) // already aligned: tile the next dst mode out
+    plan.a = dst_order[R - 2];
+  for (std::size_t d = R; d-- > 0;)
+    if (dst_order[d] != plan.a && dst_order[d] != plan.b)
+      plan.outer[plan.outer_count++] = dst_order[d];
+  return plan;
+}
+
+template <std::size_t R>
+[[nodiscard]] constexpr bool is_permutation(std::array<std::size_t, R> p) {
+  std::sort(p.begin(), p.end());
+  for (std::size_t k = 0; k < R; ++k)
+    if (p[k] != k)
+      return false;
+  return true;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Engine
+// ─────────────────────────────────────────────────────────────────────────────
+
+template <class Src, class Dst, class Op>
+void permute_copy_impl(Src const &src, Dst const &dst,
+                       std::array<std::size_t, Src::rank()> const &perm,
+                       Op &op, std::size_t num_threads) {
+  constexpr std::size_t R = Src::rank();
+  static_assert(Dst::rank() == R, "mdspan_cute::permute_copy: rank mismatch");
+  using dst_coord = index_array<typename Dst::extents_type>;
+  using src_coord = index_array<typename Src::extents_type>;
+  using dst_index = typename Dst::index_type;
+  using value_type = typename Dst::value_type;
+
+  assert(is_permutation(perm));
+  for (std::size_t k = 0; k < R; ++k)
+    assert(static_cast<std::size_t>(dst.extent(k)) ==
+           static_cast<std::size_t>(src.extent(perm[k])));
+
+  auto const to_src = [&](dst_coord const &c) {
+    src_coord s{};
+    for (std::size_t k = 0; k < R; ++k)
+      s[perm[k]] = static_cast<typename src_coord::value_type>(c[k]);
+    return s;
+  };
+  auto const load = [&](dst_coord const &c) -> value_type {
+    return static_cast<value_type>(op(element_at(src, to_src(c))));
+  };
+
+  if constexpr (R == 0) {
+    dst[] = load(dst_coord{});
+  } else if constexpr (R == 1) {
+    std::size_t const n = dst.extent(0);
+    parallel_for_chunks(n, threads_for(n, num_threads),
+                        [&](std::size_t b, std::size_t e) {
+                          for (std::size_t i = b; i < e; ++i) {
+                            dst_coord const c{static_cast<dst_index>(i)};
+                            element_at(dst, c) = load(c);
+                          }
+                        });
+  } else {
+    auto const ext = extents_array(dst.extents());
+    auto const dst_s = mode_strides(dst.mapping());
+    auto const src_s_raw = mode_strides(src.mapping());
+    stride_array<R> src_s{};
+    for (std::size_t k = 0; k < R; ++k)
+      src_s[k] = src_s_raw[perm[k]];
+    auto const plan = make_permute_plan(dst_s, src_s);
+
+    // Signed strides per dst mode when both sides are affine
+    auto const dst_aff = affine_strides(dst.mapping());
+    auto const src_aff_raw = affine_strides(src.mapping());
+    bool const affine = dst_aff && src_aff_raw;
+    std::array<std::ptrdiff_t, R> src_aff{};
+    if (affine)
+      for (std::size_t k = 0; k < R; ++k)
+        src_aff[k] = (*src_aff_raw)[perm[k]];
+
+    constexpr std::size_t M = permute_micro_tile;
+    constexpr std::size_t B =
+        permute_block_edge<typename Src::value_type, value_type>();
+    std::size_t const ea = ext[plan.a], eb = ext[plan.b];
+    std::size_t const nba = (ea + B - 1) / B, nbb = (eb + B - 1) / B;
+    std::size_t outer_total = 1;
+    for (std::size_t d = 0; d < plan.outer_count; ++d)
+      outer_total *= static_cast<std::size_t>(ext[plan.outer[d]]);
+    std::size_t const blocks = outer_total * nba * nbb;
+
+    // One micro-tile at dst coordinate c (c[a], c[b] = tile origin)
+    auto const micro = [&](dst_coord c, std::size_t na, std::size_t nb) {
+      value_type buf[M][M];
+      auto const a0 = c[plan.a], b0 = c[plan.b];
+      if (affine) {
+        auto const sbase = static_cast<std::ptrdiff_t>(
+            offset_at(src.mapping(), to_src(c)));
+        auto const dbase =
+            static_cast<std::ptrdiff_t>(offset_at(dst.mapping(), c));
+        auto const ssa = src_aff[plan.a], ssb = src_aff[plan.b];
+        auto const dsa = (*dst_aff)[plan.a], dsb = (*dst_aff)[plan.b];
+        for (std::size_t ib = 0; ib < nb; ++ib)
+          for (std::size_t ia = 0; ia < na; ++ia)
+            buf[ia][ib] = static_cast<value_type>(op(src.accessor().access(
+                src.data_handle(),
+                static_cast<std::size_t>(sbase + std::ptrdiff_t(ia) * ssa +
+                                         std::ptrdiff_t(ib) * ssb))));
+        for (std::size_t ia = 0; ia < na; ++ia)
+          for (std::size_t ib = 0; ib < nb; ++ib)
+            dst.accessor().access(
+                dst.data_handle(),
+                static_cast<std::size_t>(dbase + std::ptrdiff_t(ia) * dsa +
+                                         std::ptrdiff_t(ib) * dsb)) =
+                buf[ia][ib];
+      } else {
+        for (std::size_t ib = 0; ib < nb; ++ib)
+          for (std::size_t ia = 0; ia < na; ++ia) {
+            c[plan.a] = a0 + static_cast<dst_index>(ia);
+            c[plan.b] = b0 + static_cast<dst_index>(ib);
+            buf[ia][ib] = load(c);
+          }
+        for (std::size_t ia = 0; ia < na; ++ia)
+          for (std::size_t ib = 0; ib < nb; ++ib) {
+            c[plan.a] = a0 + static_cast<dst_index>(ia);
+            c[plan.b] = b0 + static_cast<dst_index>(ib);
+            element_at(dst, c) = buf[ia][ib];
+          }
+      }
+    };
+
+    // Block id → (outer coordinate, block a, block b), block b fastest
+    auto const block = [&](std::size_t id) {
+      dst_coord c{};
+      std::size_t const bb = id % nbb;
+      id /= nbb;
+      std::size_t const ba = id % nba;
+      id /= nba;
+      for (std::size_t d = 0; d < plan.outer_count; ++d) {
+        auto const e = static_cast<std::size_t>(ext[plan.outer[d]]);
+        c[plan.outer[d]] = static_cast<dst_index>(id % e);
+        id /= e;
+      }
+      std::size_t const a_end = std::min(ea, (ba + 1) * B);
+      std::size_t const b_end = std::min(eb, (bb + 1) * B);
+      for (std::size_t ta = ba * B; ta < a_end; ta += M)
+        for (std::size_t tb = bb * B; tb < b_end; tb += M) {
+          c[plan.a] = static_cast<dst_index>(ta);
+          c[plan.b] = static_cast<dst_index>(tb);
+          micro(c, std::min(M, a_end - ta), std::min(M, b_end - tb));
+        }
+    };
+
+    parallel_for_chunks(blocks, threads_for(dst.size(), num_threads),
+                        [&](std::size_t b, std::size_t e) {
+                          for (std::size_t id = b; id < e; ++id)
+                            block(id);
+                        });
+  }
+}
+
+} // namespace detail
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// permute_copy(src, dst[, perm[, op[, num_threads]]])
+// dst[i_0, ..., i_{R-1}] = op(src[j]) with j[perm[k]] = i_k
+// ═══════════════════════════════════════════════════════════════════════════════
+
+template <class TS, class ES, class LS, class AS, class TD, class ED,
+          class LD, class AD, class Op = std::identity>
+void permute_copy(std::mdspan<TS, ES, LS, AS> src,
+                  std::mdspan<TD, ED, LD, AD> dst,
+                  std::array<std::size_t, ES::rank()> const &perm,
+                  Op op = {},
+                  std::size_t num_threads = default_num_threads()) {
+  detail::permute_copy_impl(src, dst, perm, op, num_threads);
+}
+
+template <class TS, class ES, class LS, class AS, class TD, class ED,
+          class LD, class AD>
+void permute_copy(std::mdspan<TS, ES, LS, AS> src,
+                  std::mdspan<TD, ED, LD, AD> dst) {
+  std::array<std::size_t, ES::rank()> perm{};
+  std::iota(perm.begin(), perm.end(), std::size_t{0});
+  permute_copy(src, dst, perm);
+}
+
+} // namespace mdspan_cute
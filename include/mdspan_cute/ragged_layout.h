@@ -0,0 +1,185 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// Copyright 2026 Weyl AI
+//
+// mdspan_cute/ragged_layout.h
+//
+// Ragged (jagged) batch layouts over a prefix-sum offset table.
+//
+//   // Sequence b holds tokens [offsets[b], offsets[b + 1]) of a packed
+//   // (total_tokens, hidden) buffer; no padding
+//   auto x = mdspan_cute::make_mdspan(
+//       packed, mdspan_cute::make_ragged_layout(offsets, batch,
+//                                               cute::make_shape(hidden)));
+//   x[b, t, h];                          // valid for t < sequence_length(x, b)
+//
+//   for (auto seq : mdspan_cute::ragged_sequences(x))
+//     seq[t, h] ...;                     // dense (len_b, hidden) view
+//
+// The mapping has shape (batch, max_len, feature modes...), where max_len is
+// the longest sequence. Like the paged and ring layouts it is a cute
+// ComposedLayout: a logical layout whose batch stride is a power of two
+// (at least max_len · features), followed by ragged_fn, which splits the
+// logical offset with a shift and mask and rebases the batch onto
+// offsets[b]:
+//
+//   (offsets[L >> shift]) · features + (L & mask)
+//
+// Indices with t ≥ len_b are outside the sequence and are not checked; they
+// alias the following sequence. required_span_size is the largest physical
+// offset + 1, (offsets[batch - 1] + max_len) · features: the packed buffer
+// needs (max_len - len_last) · features elements of slack past
+// offsets[batch] · features, none when the last sequence is the longest.
+
+#pragma once
+
+#include <mdspan_cute/layout_cute.h>
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include <cute/layout.hpp>
+
+namespace mdspan_cute {
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// ragged_fn: logical (batch, rest) offset → packed offset
+// ═══════════════════════════════════════════════════════════════════════════════
+
+struct ragged_fn {
+  std::int64_t const *offsets = nullptr; // batch + 1 prefix sums, in rows
+  std::int64_t row = 1;                  // elements per token (features)
+  int shift = 0;                         // log2 of the logical batch stride
+  std::int64_t batch = 0;                // sequences
+  std::int64_t max_len = 0;              // tokens in the longest sequence
+
+  template <class I>
+  [[nodiscard]] constexpr auto operator()(I const &offset) const noexcept
+      -> std::int64_t {
+    auto const l = static_cast<std::int64_t>(offset);
+    auto const mask = (std::int64_t{1} << shift) - 1;
+    return offsets[l >> shift] * row + (l & mask);
+  }
+
+  // Hook read by layout_cute (required_span_size): the last sequence starts
+  // furthest in and its logical rows run to max_len
+  [[nodiscard]] constexpr auto span_size() const noexcept -> std::int64_t {
+    return batch > 0 ? (offsets[batch - 1] + max_len) * row : 0;
+  }
+
+  friend constexpr bool operator==(ragged_fn const &,
+                                   ragged_fn const &) = default;
+};
+
+// Cute layouts produced by make_ragged_layout
+template <class L>
+concept ragged_cute_layout = requires(L const &l) {
+  requires std::same_as<std::remove_cvref_t<decltype(l.layout_a())>,
+                        ragged_fn>;
+};
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// make_ragged_layout(offsets, batch, feature_shape)
+// Shape (batch, max_len, feature modes...); features are row-major
+// ═══════════════════════════════════════════════════════════════════════════════
+
+template <class FeatureShape>
+[[nodiscard]] constexpr auto
+make_ragged_layout(std::int64_t const *offsets, std::int64_t batch,
+                   FeatureShape const &feature_shape) {
+  std::int64_t max_len = 0;
+  for (std::int64_t b = 0; b < batch; ++b) {
+    assert(offsets[b + 1] >= offsets[b] &&
+           "mdspan_cute::make_ragged_layout: offsets must be non-decreasing");
+    max_len = std::max(max_len, offsets[b + 1] - offsets[b]);
+  }
+
+  auto const features = detail::flatten_shape(feature_shape);
+  auto const dense = cute::make_layout(
+      cute::tuple_cat(cute::make_shape(max_len), features),
+      cute::LayoutRight{});
+  auto const row = static_cast<std::int64_t>(cute::size(features));
+  auto const span = std::max<std::int64_t>(1, max_len * row);
+  int const shift = std::bit_width(static_cast<std::uint64_t>(span - 1));
+
+  // (batch, dense modes...) with batch stride 2^shift
+  auto const inner = cute::make_layout(
+      cute::tuple_cat(cute::make_shape(batch), cute::shape(dense)),
+      cute::tuple_cat(cute::make_stride(std::int64_t{1} << shift),
+                      cute::stride(dense)));
+  return cute::composition(ragged_fn{offsets, row, shift, batch, max_len},
+                           cute::Int<0>{}, inner);
+}
+
+// Tokens in sequence b
+template <class T, class E, class CuteLayout, class A>
+  requires ragged_cute_layout<CuteLayout>
+[[nodiscard]] constexpr auto
+sequence_length(std::mdspan<T, E, layout_cute<CuteLayout>, A> const &x,
+                std::size_t b) -> std::size_t {
+  auto const *offsets = x.mapping().cute_layout().layout_a().offsets;
+  return static_cast<std::size_t>(offsets[b + 1] - offsets[b]);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// ragged_sequences(x): range of dense (len_b, feature modes...) row-major
+// mdspans, one per sequence, in batch order
+// ═══════════════════════════════════════════════════════════════════════════════
+
+template <class T, class E, class CuteLayout, class A>
+  requires ragged_cute_layout<CuteLayout>
+[[nodiscard]] constexpr auto
+ragged_sequences(std::mdspan<T, E, layout_cute<CuteLayout>, A> const &x) {
+  auto const &layout = x.mapping().cute_layout();
+  ragged_fn const fn = layout.layout_a();
+  auto const full = cute::shape(layout.layout_b());
+  constexpr std::size_t R =
+      cute::tuple_size<std::remove_cvref_t<decltype(full)>>::value;
+  auto const features = cute::take<2, R>(full);
+  using element_pointer = typename A::data_handle_type;
+
+  struct range {
+    element_pointer data;
+    ragged_fn fn;
+    std::remove_cvref_t<decltype(features)> feature_shape;
+    std::int64_t batch;
+
+    [[nodiscard]] constexpr auto operator[](std::int64_t b) const {
+      auto const len = fn.offsets[b + 1] - fn.offsets[b];
+      auto const shape =
+          cute::tuple_cat(cute::make_shape(len), feature_shape);
+      return make_mdspan(data + fn.offsets[b] * fn.row,
+                         cute::make_layout(shape, cute::LayoutRight{}));
+    }
+
+    struct iterator {
+      range const *r;
+      std::int64_t b;
+      constexpr auto operator*() const { return (*r)[b]; }
+      constexpr auto operator++() -> iterator & {
+        ++b;
+        return *this;
+      }
+      constexpr bool operator==(iterator const &o) const { return b == o.b; }
+    };
+
+    [[nodiscard]] constexpr auto begin() const -> iterator {
+      return {this, 0};
+    }
+    [[nodiscard]] constexpr auto end() const -> iterator {
+      return {this, batch};
+    }
+    [[nodiscard]] constexpr auto size() const -> std::size_t {
+      return static_cast<std::size_t>(batch);
+    }
+  };
+
+  return range{x.data_handle(), fn, features,
+               static_cast<std::int64_t>(x.extent(0))};
+}
+
+} // namespace mdspan_cute
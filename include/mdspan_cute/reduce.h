@@ -0,0 +1,370 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// Copyright 2026 Weyl AI
+//
+// mdspan_cute/reduce.h
+//
+// Mode-wise reductions over layout_cute mdspans.
+//
+//   reduce<Modes...>(src, dst, reducer)
+//
+// reduces the listed source modes away; dst holds the remaining modes in
+// their original order. The loop nest is ordered by the physical strides of
+// the source (loop_order.h), so swizzled, transposed and hierarchical tensors
+// are read in memory order rather than logical order. The innermost run uses
+// pointer strides whenever the source mapping is affine; a run along a
+// reduced mode feeds reduce_lanes independent accumulators, so a float sum is
+// not one serial dependency chain and can vectorize. Work is split across
+// threads along a kept mode, so every output element has a single owner; a
+// full reduction splits a reduced mode instead and combines the partials in
+// a fixed order.
+//
+// Usage:
+//   reduce<1>(x, row_sums, sum_reducer<float>{});       // (M,N) → (M)
+//   reduce<0>(x, col_argmax, argmax_reducer<float>{});  // (M,N) → (N)
+
+#pragma once
+
+#include <mdspan_cute/index_space.h>
+#include <mdspan_cute/layout_cute.h>
+#include <mdspan_cute/loop_order.h>
+#include <mdspan_cute/parallel.h>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace mdspan_cute {
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Reducers
+// accumulate() also receives the row-major position of the element within the
+// reduced modes, so positional reductions (argmax) work in any visit order.
+// ═══════════════════════════════════════════════════════════════════════════════
+
+template <class R, class T>
+concept reducer_for = requires(R const &r, typename R::accumulator_type &acc,
+                               typename R::accumulator_type const &other,
+                               T const &v, std::size_t pos) {
+  { r.init() } -> std::convertible_to<typename R::accumulator_type>;
+  r.accumulate(acc, v, pos);
+  r.combine(acc, other);
+  r.finish(other);
+};
+
+template <class T> struct sum_reducer {
+  using accumulator_type = T;
+  constexpr T init() const { return T{}; }
+  constexpr void accumulate(T &acc, T const &v, std::size_t) const {
+    acc += v;
+  }
+  constexpr void combine(T &acc, T const &other) const { acc += other; }
+  constexpr T finish(T const &acc) const { return acc; }
+};
+
+template <class T> struct max_reducer {
+  using accumulator_type = T;
+  constexpr T init() const { return std::numeric_limits<T>::lowest(); }
+  constexpr void accumulate(T &acc, T const &v, std::size_t) const {
+    acc = v > acc ? v : acc;
+  }
+  constexpr void combine(T &acc, T const &other) const {
+    acc = other > acc ? other : acc;
+  }
+  constexpr T finish(T const &acc) const { return acc; }
+};
+
+template <class T> struct min_reducer {
+  using accumulator_type = T;
+  constexpr T init() const { return std::numeric_limits<T>::max(); }
+  constexpr void accumulate(T &acc, T const &v, std::size_t) const {
+    acc = v < acc ? v : acc;
+  }
+  constexpr void combine(T &acc, T const &other) const {
+    acc = other < acc ? other : acc;
+  }
+  constexpr T finish(T const &acc) const { return acc; }
+};
+
+// Position of the maximum within the reduced modes; ties go to the smallest
+// position, independent of the order the engine visits elements in
+template <class T> struct argmax_reducer {
+  struct accumulator_type {
+    T value = std::numeric_limits<T>::lowest();
+    std::size_t index = std::numeric_limits<std::size_t>::max();
+  };
+  constexpr accumulator_type init() const { return {}; }
+  constexpr void accumulate(accumulator_type &acc, T const &v,
+                            std::size_t pos) const {
+    if (v > acc.value || (v == acc.value && pos < acc.index))
+      acc = {v, pos};
+  }
+  constexpr void combine(accumulator_type &acc,
+                         accumulator_type const &other) const {
+    accumulate(acc, other.value, other.index);
+  }
+  constexpr std::size_t finish(accumulator_type const &acc) const {
+    return acc.index;
+  }
+};
+
+// Any associative, commutative binary op with an identity
+template <class Op, class T> struct fold_reducer {
+  using accumulator_type = T;
+  [[no_unique_address]] Op op{};
+  T identity{};
+  constexpr T init() const { return identity; }
+  constexpr void accumulate(T &acc, T const &v, std::size_t) const {
+    acc = op(acc, v);
+  }
+  constexpr void combine(T &acc, T const &other) const {
+    acc = op(acc, other);
+  }
+  constexpr T finish(T const &acc) const { return acc; }
+};
+
+// ═══════════════════════════════════════════════════════════════════════════════
+namespace detail {
+
+// Independent partial accumulators per reduced inner run
+inline constexpr std::size_t reduce_lanes = 8;
+
+template <std::size_t Rank, std::size_t... Modes>
+consteval auto reduced_mask() {
+  std::array<bool, Rank> mask{};
+  ((mask[Modes] = true), ...);
+  return mask;
+}
+
+template <std::size_t Rank, std::size_t... Modes>
+consteval bool valid_reduced_modes() {
+  std::array<std::size_t, sizeof...(Modes)> m{Modes...};
+  for (std::size_t i = 0; i < m.size(); ++i) {
+    if (m[i] >= Rank)
+      return false;
+    for (std::size_t j = 0; j < i; ++j)
+      if (m[i] == m[j])
+        return false;
+  }
+  return true;
+}
+
+// Source modes that survive into dst, in order
+template <std::size_t Rank, std::size_t... Modes>
+consteval auto kept_modes() {
+  constexpr auto mask = reduced_mask<Rank, Modes...>();
+  std::array<std::size_t, Rank - sizeof...(Modes)> kept{};
+  for (std::size_t s = 0, j = 0; s < Rank; ++s)
+    if (!mask[s])
+      kept[j++] = s;
+  return kept;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Reduce the box [lo, hi) of src into acc, a dense row-major buffer over the
+// kept modes of the box (a single accumulator when every mode is reduced)
+// ─────────────────────────────────────────────────────────────────────────────
+
+template <class Src, class Reducer, std::size_t R>
+void reduce_box(Src const &src, Reducer const &r,
+                std::array<bool, R> const &reduced,
+                mode_order<R> const &order,
+                index_array<typename Src::extents_type> const &lo,
+                index_array<typename Src::extents_type> const &hi,
+                std::vector<typename Reducer::accumulator_type> &acc) {
+  using index_type = typename Src::index_type;
+
+  // Row-major positions: within the reduced modes (for accumulate) and
+  // within the kept modes of the box (for the accumulator buffer)
+  std::array<std::size_t, R> pos_stride{}, acc_stride{};
+  auto const exts = detail::extents_array(src.extents());
+  std::size_t ps = 1, as = 1;
+  for (std::size_t k = R; k-- > 0;) {
+    if (reduced[k]) {
+      pos_stride[k] = ps;
+      ps *= static_cast<std::size_t>(exts[k]);
+    } else {
+      acc_stride[k] = as;
+      as *= static_cast<std::size_t>(hi[k] - lo[k]);
+    }
+  }
+  acc.assign(as, r.init());
+
+  auto const position = [&](auto const &c) {
+    std::size_t pos = 0, a = 0;
+    for (std::size_t k = 0; k < R; ++k) {
+      if (reduced[k])
+        pos += static_cast<std::size_t>(c[k]) * pos_stride[k];
+      else
+        a += static_cast<std::size_t>(c[k] - lo[k]) * acc_stride[k];
+    }
+    return std::pair{pos, a};
+  };
+
+  auto const &m = src.mapping();
+  auto const p = src.data_handle();
+  auto const &accessor = src.accessor();
+  auto const affine = affine_strides(m);
+  std::size_t const inner = order[R - 1];
+  auto const len = static_cast<std::size_t>(hi[inner] - lo[inner]);
+
+  auto run = [&](auto const &c) {
+    auto const [pos0, a0] = position(c);
+    if (affine) {
+      auto const base = static_cast<std::ptrdiff_t>(offset_at(m, c));
+      std::ptrdiff_t const step = (*affine)[inner];
+      if (reduced[inner]) {
+        std::size_t const dpos = pos_stride[inner];
+        auto const at = [&](std::size_t i) -> decltype(auto) {
+          return accessor.access(
+              p, static_cast<std::size_t>(base + std::ptrdiff_t(i) * step));
+        };
+        // Lane j takes elements j, j + lanes, ...; combined once per run
+        std::array<typename Reducer::accumulator_type, reduce_lanes> lanes;
+        lanes.fill(r.init());
+        std::size_t i = 0;
+        for (; i + reduce_lanes <= len; i += reduce_lanes)
+          for (std::size_t j = 0; j < reduce_lanes; ++j)
+            r.accumulate(lanes[j], at(i + j), pos0 + (i + j) * dpos);
+        for (std::size_t j = 0; i < len; ++i, ++j)
+          r.accumulate(lanes[j], at(i), pos0 + i * dpos);
+        for (auto const &lane : lanes)
+          r.combine(acc[a0], lane);
+      } else {
+        auto *slots = acc.data() + a0;
+        std::size_t const da = acc_stride[inner];
+        for (std::size_t i = 0; i < len; ++i)
+          r.accumulate(slots[i * da],
+                       accessor.access(p, static_cast<std::size_t>(
+                                              base + std::ptrdiff_t(i) * step)),
+                       pos0);
+      }
+    } else {
+      auto e = c;
+      for (std::size_t i = 0; i < len; ++i) {
+        e[inner] = lo[inner] + static_cast<index_type>(i);
+        auto const &v = accessor.access(
+            p, static_cast<std::size_t>(offset_at(m, e)));
+        if (reduced[inner])
+          r.accumulate(acc[a0], v, pos0 + i * pos_stride[inner]);
+        else
+          r.accumulate(acc[a0 + i * acc_stride[inner]], v, pos0);
+      }
+    }
+  };
+
+  auto c = lo;
+  for_each_run(lo, hi, order, c, run);
+}
+
+} // namespace detail
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// reduce<Modes...>(src, dst, reducer [, num_threads])
+// ═══════════════════════════════════════════════════════════════════════════════
+
+template <std::size_t... Modes, class TS, class ES, class LS, class AS,
+          class TD, class ED, class LD, class AD, class Reducer>
+  requires reducer_for<Reducer, std::remove_cv_t<TS>>
+void reduce(std::mdspan<TS, ES, LS, AS> src, std::mdspan<TD, ED, LD, AD> dst,
+            Reducer const &r,
+            std::size_t num_threads = default_num_threads()) {
+  constexpr std::size_t R = ES::rank();
+  constexpr std::size_t RD = ED::rank();
+  static_assert(sizeof...(Modes) > 0,
+                "mdspan_cute::reduce: list at least one mode to reduce");
+  static_assert(detail::valid_reduced_modes<R, Modes...>(),
+                "mdspan_cute::reduce: modes must be distinct and < rank(src)");
+  static_assert(RD == R - sizeof...(Modes),
+                "mdspan_cute::reduce: rank(dst) != rank(src) - #modes");
+
+  using src_index = typename ES::index_type;
+  using acc_type = typename Reducer::accumulator_type;
+  constexpr auto reduced = detail::reduced_mask<R, Modes...>();
+
+  // kept[j] = source mode feeding dst mode j
+  constexpr auto kept = detail::kept_modes<R, Modes...>();
+
+  auto const exts = detail::extents_array(src.extents());
+  for (std::size_t j = 0; j < RD; ++j)
+    assert(static_cast<std::size_t>(dst.extent(j)) ==
+           static_cast<std::size_t>(exts[kept[j]]));
+
+  auto const order = stride_order(mode_strides(src.mapping()));
+  std::size_t const work = src.size();
+  std::size_t const threads = threads_for(work, num_threads);
+
+  if constexpr (RD > 0) {
+    // Split the largest kept mode; each thread owns its slice of dst
+    std::size_t split = kept[0];
+    for (auto k : kept)
+      if (exts[k] > exts[split])
+        split = k;
+
+    parallel_for_chunks(
+        static_cast<std::size_t>(exts[split]), threads,
+        [&](std::size_t b, std::size_t e) {
+          index_array<ES> lo{}, hi = exts;
+          lo[split] = static_cast<src_index>(b);
+          hi[split] = static_cast<src_index>(e);
+
+          std::vector<acc_type> acc;
+          detail::reduce_box(src, r, reduced, order, lo, hi, acc);
+
+          // Write back in dst order; acc is row-major over the kept box
+          index_array<ED> dlo{}, dhi{}, d{};
+          for (std::size_t j = 0; j < RD; ++j) {
+            dlo[j] = static_cast<typename ED::index_type>(lo[kept[j]]);
+            dhi[j] = static_cast<typename ED::index_type>(hi[kept[j]]);
+          }
+          std::size_t i = 0;
+          auto store = [&](index_array<ED> const &dc) {
+            detail::element_at(dst, dc) = r.finish(acc[i++]);
+          };
+          detail::for_each_in_box(dlo, dhi, d, store);
+        });
+  } else {
+    // Full reduction: split the largest reduced mode, combine in chunk order
+    std::size_t split = 0;
+    for (std::size_t k = 1; k < R; ++k)
+      if (exts[k] > exts[split])
+        split = k;
+
+    std::size_t const n = static_cast<std::size_t>(exts[split]);
+    std::size_t const chunks = std::min(threads, std::max<std::size_t>(1, n));
+    std::vector<acc_type> partial(chunks, r.init());
+
+    parallel_for_chunks(chunks, chunks, [&](std::size_t b, std::size_t e) {
+      for (std::size_t ci = b; ci < e; ++ci) {
+        index_array<ES> lo{}, hi = exts;
+        lo[split] = static_cast<src_index>(n * ci / chunks);
+        hi[split] = static_cast<src_index>(n * (ci + 1) / chunks);
+        std::vector<acc_type> acc;
+        detail::reduce_box(src, r, reduced, order, lo, hi, acc);
+        partial[ci] = acc[0];
+      }
+    });
+
+    acc_type total = r.init();
+    for (auto const &part : partial)
+      r.combine(total, part);
+    detail::element_at(dst, index_array<ED>{}) = r.finish(total);
+  }
+}
+
+// Binary op + identity convenience: reduce<1>(x, y, std::plus<>{}, 0.0f)
+template <std::size_t... Modes, class TS, class ES, class LS, class AS,
+          class TD, class ED, class LD, class AD, class Op, class T>
+  requires std::invocable<Op const &, T const &, std::remove_cv_t<TS> const &>
+void reduce(std::mdspan<TS, ES, LS, AS> src, std::mdspan<TD, ED, LD, AD> dst,
+            Op op, T identity,
+            std::size_t num_threads = default_num_threads()) {
+  reduce<Modes...>(src, dst, fold_reducer<Op, T>{op, identity}, num_threads);
+}
+
+} // namespace mdspan_cute
@@ -0,0 +1,212 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// Copyright 2026 Weyl AI
+//
+// mdspan_cute/relayout.h
+//
+// In-place relayout between exhaustive layouts of the same size.
+//
+//   auto w = relayout_in_place(row_major_md, swizzle::make_swizzled_layout<
+//                                  swizzle::sw128>(shape, stride));
+//   // *w: same buffer, now addressed (and physically ordered) by the target
+//
+// The element stored at source offset p has coordinate src⁻¹(p) and belongs
+// at target offset P(p) = target(src⁻¹(p)). P is a permutation of [0, n) and
+// is applied by cycle-following, so the only extra memory is one bit per
+// element.
+//
+// Cycles are independent and are rotated in parallel. Each thread scans a
+// chunk of offsets and rotates the cycles whose smallest offset falls in its
+// chunk, so every cycle has exactly one owner and needs no locks. The bitset
+// only lets scans skip cycles that are already done.
+//
+// src⁻¹ comes from cute's right_inverse when the source is a compact cute
+// layout (storage_order.h) and from mixed-radix division when it is a compact
+// affine mapping. When neither applies, the cycles are walked backwards
+// through P⁻¹(q) = src(target⁻¹(q)) instead, which needs only the target to
+// be invertible. No offset → index table is ever built: when neither side
+// inverts (e.g. Morton → Hilbert), the buffer is left untouched and the call
+// returns nullopt rather than paying n indices of scratch.
+
+#pragma once
+
+#include <mdspan_cute/index_space.h>
+#include <mdspan_cute/layout_cute.h>
+#include <mdspan_cute/loop_order.h>
+#include <mdspan_cute/parallel.h>
+#include <mdspan_cute/storage_order.h>
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace mdspan_cute {
+
+// ═══════════════════════════════════════════════════════════════════════════════
+namespace detail {
+
+// ─────────────────────────────────────────────────────────────────────────────
+// with_offset_inverse: body(inv) with inv(p) → coordinate stored at offset p
+// (exhaustive mappings only). Returns false, without calling body, when m has
+// no closed-form inverse.
+// ─────────────────────────────────────────────────────────────────────────────
+
+template <class Mapping, class F>
+[[nodiscard]] bool with_offset_inverse(Mapping const &m, F &&body) {
+  using extents_type = typename Mapping::extents_type;
+  using coord_type = index_array<extents_type>;
+  constexpr std::size_t R = extents_type::rank();
+  auto const exts = extents_array(m.extents());
+  std::size_t const n = static_cast<std::size_t>(m.required_span_size());
+  std::size_t size = 1;
+  for (std::size_t k = 0; k < R; ++k)
+    size *= static_cast<std::size_t>(exts[k]);
+
+  if (auto const inv = storage_inverse_of(m)) {
+    if constexpr (!std::is_same_v<std::remove_cvref_t<decltype(*inv)>,
+                                  no_storage_inverse>) {
+      body([&](std::size_t p) -> coord_type {
+        return unflatten_colex(static_cast<std::size_t>((*inv)(p)), exts);
+      });
+      return true;
+    }
+  }
+
+  // Compact affine: strides nest exactly, so p is a mixed-radix number
+  if (n == size && nested_storage_order(m)) {
+    auto const s = *affine_strides(m);
+    body([&](std::size_t p) -> coord_type {
+      coord_type c{};
+      for (std::size_t k = 0; k < R; ++k)
+        if (exts[k] > 1)
+          c[k] = static_cast<typename coord_type::value_type>(
+              (p / static_cast<std::size_t>(s[k])) %
+              static_cast<std::size_t>(exts[k]));
+      return c;
+    });
+    return true;
+  }
+  return false;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// permute_cycles: apply the permutation whose cycles `step` walks. Forward
+// steps follow P (the element at p moves to step(p)); backward steps follow
+// P⁻¹ (the element at step(q) moves to q).
+// ─────────────────────────────────────────────────────────────────────────────
+
+template <bool Backward, class T, class E, class L, class A, class Step>
+void permute_cycles(std::mdspan<T, E, L, A> const &md, Step const &step,
+                    std::size_t num_threads) {
+  std::size_t const n = md.size();
+  std::vector<std::atomic<std::uint64_t>> done((n + 63) / 64);
+  auto const is_done = [&](std::size_t p) {
+    return (done[p >> 6].load(std::memory_order_relaxed) >> (p & 63)) & 1u;
+  };
+  auto const mark = [&](std::size_t p) {
+    done[p >> 6].fetch_or(std::uint64_t{1} << (p & 63),
+                          std::memory_order_relaxed);
+  };
+
+  auto const &acc = md.accessor();
+  auto const ptr = md.data_handle();
+
+  parallel_for_chunks(
+      n, threads_for(n, num_threads), [&](std::size_t b, std::size_t e) {
+        for (std::size_t p = b; p < e; ++p) {
+          if (is_done(p))
+            continue;
+          std::size_t q = step(p);
+          if (q == p)
+            continue;
+
+          // Only the smallest offset of a cycle rotates it
+          bool leader = true;
+          for (std::size_t r = q; r != p && leader; r = step(r))
+            leader = r > p;
+          if (!leader)
+            continue;
+
+          typename A::element_type carry = std::move(acc.access(ptr, p));
+          if constexpr (Backward) {
+            std::size_t hole = p;
+            for (; q != p; hole = q, q = step(q)) {
+              acc.access(ptr, hole) = std::move(acc.access(ptr, q));
+              mark(q);
+            }
+            acc.access(ptr, hole) = std::move(carry);
+          } else {
+            using std::swap;
+            for (; q != p; q = step(q)) {
+              swap(carry, acc.access(ptr, q));
+              mark(q);
+            }
+            acc.access(ptr, p) = std::move(carry);
+          }
+          mark(p);
+        }
+      });
+}
+
+} // namespace detail
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// relayout_in_place: permute md's buffer into `target` order
+// Preconditions: md's mapping and `target` are both exhaustive and unique
+// (cosize == size) over the same extents. Returns the buffer viewed through
+// the target layout, or nullopt (buffer unchanged) when neither layout is a
+// compact cute or affine layout with a closed-form inverse.
+// ═══════════════════════════════════════════════════════════════════════════════
+
+template <class T, class E, class L, class A, cute_layout Target>
+auto relayout_in_place(std::mdspan<T, E, L, A> md, Target const &target,
+                       std::size_t num_threads = default_num_threads()) {
+  static_assert(!std::is_const_v<T>,
+                "mdspan_cute::relayout_in_place: source must be mutable");
+  using target_extents = detail::layout_cute_extents_t<Target>;
+  using target_mapping =
+      typename layout_cute<Target>::template mapping<target_extents>;
+  static_assert(target_extents::rank() == E::rank(),
+                "mdspan_cute::relayout_in_place: rank mismatch");
+
+  target_mapping const tm(target);
+  std::size_t const n = md.size();
+  for (std::size_t k = 0; k < E::rank(); ++k)
+    assert(static_cast<std::size_t>(tm.extents().extent(k)) ==
+           static_cast<std::size_t>(md.extent(k)));
+  assert(static_cast<std::size_t>(md.mapping().required_span_size()) == n);
+  assert(static_cast<std::size_t>(tm.required_span_size()) == n);
+
+  auto const &sm = md.mapping();
+  bool const inverted =
+      detail::with_offset_inverse(sm, [&](auto const &src_inv) {
+        detail::permute_cycles<false>(
+            md,
+            [&](std::size_t p) {
+              return static_cast<std::size_t>(
+                  detail::offset_at(tm, src_inv(p)));
+            },
+            num_threads);
+      }) ||
+      detail::with_offset_inverse(tm, [&](auto const &target_inv) {
+        detail::permute_cycles<true>(
+            md,
+            [&](std::size_t q) {
+              return static_cast<std::size_t>(
+                  detail::offset_at(sm, target_inv(q)));
+            },
+            num_threads);
+      });
+
+  using result = std::mdspan<T, target_extents, layout_cute<Target>, A>;
+  if (!inverted)
+    return std::optional<result>{};
+  return std::optional<result>{std::in_place, md.data_handle(), tm,
+                               md.accessor()};
+}
+
+} // namespace mdspan_cute
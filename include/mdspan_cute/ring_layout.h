@@ -0,0 +1,174 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// Copyright 2026 Weyl AI
+//
+// mdspan_cute/ring_layout.h
+//
+// Circular-buffer layouts for streaming windows.
+//
+//   auto ring = mdspan_cute::make_mdspan(buf, mdspan_cute::make_ring_layout(
+//       cute::Int<64>{}, cute::make_shape(cute::Int<16>{})));
+//   // ring[t, f]: t = 0 is the oldest of 64 rows of 16 features
+//
+//   ring = mdspan_cute::advance_ring(ring, 1); // drop the oldest row
+//   for (int f = 0; f < 16; ++f)
+//     ring[63, f] = sample[f];                  // newest row reuses its slot
+//
+//   for (auto run : mdspan_cute::ring_spans(ring)) // at most two runs
+//     std::memcpy(out, run.data(), run.size_bytes()), out += run.size();
+//
+// The outer mode wraps modulo the capacity. Rows are dense (row shape
+// row-major) and the layout is a cute ComposedLayout: a row-major logical
+// layout followed by ring_fn, which adds the head offset and wraps it into
+// [0, capacity · row size). Advancing the window only moves the head.
+//
+// The wrap is a mask when the total size is a static power of two (cute::Int
+// capacity and row shape), chosen at compile time, and one compare-subtract
+// otherwise; no division in either case.
+
+#pragma once
+
+#include <mdspan_cute/layout_cute.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+#include <cute/layout.hpp>
+
+namespace mdspan_cute {
+
+// ═══════════════════════════════════════════════════════════════════════════════
+namespace detail {
+
+template <class T> struct is_static_pow2 : std::false_type {};
+
+template <auto N>
+struct is_static_pow2<cute::C<N>>
+    : std::bool_constant<(N > 0) && ((N & (N - 1)) == 0)> {};
+
+} // namespace detail
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// ring_fn<Total>: logical offset → (offset + head) mod total
+// ═══════════════════════════════════════════════════════════════════════════════
+
+template <class Total> struct ring_fn {
+  static constexpr bool uses_mask = detail::is_static_pow2<Total>::value;
+
+  Total total{};         // capacity · row size
+  std::int64_t row = 1;  // elements per row
+  std::int64_t head = 0; // physical offset of logical row 0, in [0, total)
+
+  template <class I>
+  [[nodiscard]] constexpr auto operator()(I const &offset) const noexcept
+      -> std::int64_t {
+    auto const p = static_cast<std::int64_t>(offset) + head;
+    auto const n = static_cast<std::int64_t>(total);
+    if constexpr (uses_mask)
+      return p & (n - 1);
+    else
+      return p >= n ? p - n : p;
+  }
+
+  // A rotation of [0, total), which is exactly the logical layout's range
+  [[nodiscard]] constexpr bool is_injective() const noexcept { return true; }
+
+  // Same ring with the head moved forward by `rows` rows
+  [[nodiscard]] constexpr auto advanced(std::int64_t rows) const noexcept
+      -> ring_fn {
+    auto const n = static_cast<std::int64_t>(total);
+    ring_fn r = *this;
+    r.head = ((head + rows * row) % n + n) % n;
+    return r;
+  }
+
+  friend constexpr bool operator==(ring_fn const &,
+                                   ring_fn const &) = default;
+};
+
+namespace detail {
+
+template <class T> inline constexpr bool is_ring_fn_v = false;
+template <class Total>
+inline constexpr bool is_ring_fn_v<ring_fn<Total>> = true;
+
+} // namespace detail
+
+// Cute layouts produced by make_ring_layout
+template <class L>
+concept ring_cute_layout = requires(L const &l) {
+  requires detail::is_ring_fn_v<std::remove_cvref_t<decltype(l.layout_a())>>;
+};
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// make_ring_layout(capacity, row_shape): shape (capacity, row modes...)
+// ═══════════════════════════════════════════════════════════════════════════════
+
+template <class Capacity, class RowShape>
+[[nodiscard]] constexpr auto make_ring_layout(Capacity const &capacity,
+                                              RowShape const &row_shape) {
+  auto const row = detail::flatten_shape(row_shape);
+  auto const inner = cute::make_layout(
+      cute::tuple_cat(cute::make_shape(capacity), row), cute::LayoutRight{});
+  auto const total = cute::size(inner);
+  using total_type = std::remove_cvref_t<decltype(total)>;
+  ring_fn<total_type> fn{total, static_cast<std::int64_t>(cute::size(row)),
+                         0};
+  return cute::composition(fn, cute::Int<0>{}, inner);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// advance_ring(ring, rows): the same buffer with logical row 0 moved `rows`
+// rows forward (negative rows move it back)
+// ═══════════════════════════════════════════════════════════════════════════════
+
+template <class T, class E, class CuteLayout, class A>
+  requires ring_cute_layout<CuteLayout>
+[[nodiscard]] constexpr auto
+advance_ring(std::mdspan<T, E, layout_cute<CuteLayout>, A> const &ring,
+             std::int64_t rows) {
+  auto const &l = ring.mapping().cute_layout();
+  CuteLayout const moved(l.layout_a().advanced(rows), l.offset(),
+                         l.layout_b());
+  using mapping_type = typename layout_cute<CuteLayout>::template mapping<E>;
+  return std::mdspan<T, E, layout_cute<CuteLayout>, A>(
+      ring.data_handle(), mapping_type(ring.extents(), moved),
+      ring.accessor());
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// ring_spans(ring, first, count): logical rows [first, first + count) as at
+// most two contiguous runs, oldest first (the second is empty unless the
+// range wraps)
+// ═══════════════════════════════════════════════════════════════════════════════
+
+template <class T, class E, class CuteLayout, class A>
+  requires ring_cute_layout<CuteLayout>
+[[nodiscard]] constexpr auto
+ring_spans(std::mdspan<T, E, layout_cute<CuteLayout>, A> const &ring,
+           std::size_t first = 0,
+           std::size_t count = std::dynamic_extent)
+    -> std::array<std::span<T>, 2> {
+  auto const &fn = ring.mapping().cute_layout().layout_a();
+  std::size_t const rows = static_cast<std::size_t>(ring.extent(0));
+  if (count == std::dynamic_extent)
+    count = rows - first;
+  assert(first + count <= rows);
+
+  auto const row = static_cast<std::size_t>(fn.row);
+  auto const total = static_cast<std::size_t>(fn.total);
+  std::size_t const begin = static_cast<std::size_t>(fn(first * row));
+  std::size_t const n = count * row;
+  std::size_t const head_run = std::min(n, total - begin);
+  T *const p = ring.data_handle();
+  return {std::span<T>(p + begin, head_run),
+          std::span<T>(p, n - head_run)};
+}
+
+} // namespace mdspan_cute
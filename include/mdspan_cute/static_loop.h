@@ -0,0 +1,119 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// Copyright 2026 Weyl AI
+//
+// mdspan_cute/static_loop.h
+//
+// Fully unrolled loop nests for fully static layouts (cute_mdspan).
+//
+// When the cute layout is an empty static type and the extents are static,
+// every (coordinate, offset) pair is known at compile time. static_for_each
+// computes them once in a consteval table, orders the table by ascending
+// physical offset, and expands the visit as a fold expression: small
+// register tiles get straight-line code with constant offsets and no index
+// arithmetic, and neighbouring accesses are adjacent in memory so the
+// compiler can combine loads.
+//
+// Usage:
+//   cute_mdspan<float, decltype(frag_layout)> frag(regs);
+//   mdspan_cute::static_for_each(frag, [](auto const &coord, float &x) {
+//     x = 0.0f;
+//   });
+
+#pragma once
+
+#include <mdspan_cute/index_space.h>
+#include <mdspan_cute/layout_cute.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <utility>
+
+namespace mdspan_cute {
+
+// Upper bound on unrolled visits; larger tiles belong in for_each_tiled
+inline constexpr std::size_t static_for_each_max_elements = 1024;
+
+// One step of an unrolled visit
+template <class Extents> struct static_visit {
+  index_array<Extents> coord{};
+  std::size_t offset = 0;
+};
+
+// ═══════════════════════════════════════════════════════════════════════════════
+namespace detail {
+
+template <class Extents>
+inline constexpr std::size_t static_extents_size_v = [] {
+  std::size_t n = 1;
+  for (std::size_t k = 0; k < Extents::rank(); ++k)
+    n *= Extents::static_extent(k);
+  return n;
+}();
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Visit table: every coordinate with its offset, sorted by offset.
+// Ties (non-unique layouts) keep logical order.
+// ─────────────────────────────────────────────────────────────────────────────
+
+template <class Extents, class CuteLayout>
+consteval auto static_visit_order() {
+  using mapping_type =
+      typename layout_cute<CuteLayout>::template mapping<Extents>;
+  constexpr std::size_t n = static_extents_size_v<Extents>;
+
+  mapping_type const m(Extents{}, CuteLayout{});
+  std::array<static_visit<Extents>, n> order{};
+  std::size_t i = 0;
+  for_each_index(Extents{}, [&](index_array<Extents> const &c) {
+    order[i].coord = c;
+    order[i].offset = static_cast<std::size_t>(offset_at(m, c));
+    ++i;
+  });
+
+  // Coordinates were generated in logical (lexicographic) order, so breaking
+  // ties on the coordinate keeps the sort stable without a scratch buffer
+  std::sort(order.begin(), order.end(), [](auto const &a, auto const &b) {
+    return a.offset != b.offset ? a.offset < b.offset : a.coord < b.coord;
+  });
+  return order;
+}
+
+template <class Extents, class CuteLayout>
+inline constexpr auto static_visit_order_v =
+    static_visit_order<Extents, CuteLayout>();
+
+} // namespace detail
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// static_for_each: unrolled f(coord, element) in ascending physical offset
+// ═══════════════════════════════════════════════════════════════════════════════
+
+template <class T, class Extents, cute_static_layout CuteLayout,
+          class Accessor, class F>
+  requires(Extents::rank_dynamic() == 0)
+constexpr void
+static_for_each(std::mdspan<T, Extents, layout_cute<CuteLayout>, Accessor> tile,
+                F &&f) {
+  static_assert(detail::static_extents_size_v<Extents> <=
+                    static_for_each_max_elements,
+                "mdspan_cute::static_for_each: tile too large to unroll; "
+                "use for_each_tiled");
+
+  constexpr auto const &order =
+      detail::static_visit_order_v<Extents, CuteLayout>;
+  auto const p = tile.data_handle();
+  auto const &acc = tile.accessor();
+  [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+    (f(order[Is].coord, acc.access(p, order[Is].offset)), ...);
+  }(std::make_index_sequence<order.size()>{});
+}
+
+// The visit table itself, for callers generating their own code from it
+template <cute_static_layout CuteLayout, class Extents>
+  requires(Extents::rank_dynamic() == 0)
+[[nodiscard]] consteval auto static_visit_table() {
+  return detail::static_visit_order_v<Extents, CuteLayout>;
+}
+
+} // namespace mdspan_cute
@@ -0,0 +1,249 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// Copyright 2026 Weyl AI
+//
+// mdspan_cute/storage_order.h
+//
+// Storage-order iteration: visit every element in increasing physical offset
+// and hand back its logical coordinate.
+//
+//   for_each_in_storage_order(md, [](auto const& coord, auto& x) { ... });
+//
+// For read-only passes (checksums, quantization statistics, serialization)
+// logical order is irrelevant but memory order is not: a transposed or
+// swizzled tensor walked in logical order touches memory out of sequence.
+//
+// Three strategies, picked per mapping:
+//   inverse  compact cute layout (optionally behind a Swizzle): walk offsets
+//            0, 1, 2, ... and recover the coordinate through cute's
+//            right_inverse. A swizzle is an involution, so sw ∘ L is
+//            inverted as right_inverse(L) ∘ sw.
+//   nested   affine mapping whose sorted strides do not interleave: a loop
+//            nest ordered by stride is already monotone in offset.
+//   sorted   anything else: (offset, coordinate) table sorted once.
+
+#pragma once
+
+#include <mdspan_cute/index_space.h>
+#include <mdspan_cute/layout_cute.h>
+#include <mdspan_cute/loop_order.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <cute/layout.hpp>
+#include <cute/swizzle.hpp>
+
+namespace mdspan_cute {
+
+enum class storage_walk { inverse, nested, sorted };
+
+// ═══════════════════════════════════════════════════════════════════════════════
+namespace detail {
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Colexicographic linear index over flat extents (cute's domain order)
+// ─────────────────────────────────────────────────────────────────────────────
+
+template <class Index, std::size_t R>
+[[nodiscard]] constexpr auto unflatten_colex(std::size_t idx,
+                                             std::array<Index, R> const &exts)
+    -> std::array<Index, R> {
+  std::array<Index, R> c{};
+  for (std::size_t k = 0; k < R; ++k) {
+    auto const e = static_cast<std::size_t>(exts[k]);
+    c[k] = static_cast<Index>(idx % e);
+    idx /= e;
+  }
+  return c;
+}
+
+template <class Index, std::size_t R>
+[[nodiscard]] constexpr auto flatten_colex(std::array<Index, R> const &c,
+                                           std::array<Index, R> const &exts)
+    -> std::size_t {
+  std::size_t idx = 0;
+  for (std::size_t k = R; k-- > 0;)
+    idx = idx * static_cast<std::size_t>(exts[k]) +
+          static_cast<std::size_t>(c[k]);
+  return idx;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// storage_inverse: physical offset → linear logical index, when the layout is
+// a bijection onto [0, size). Empty optional otherwise.
+// ─────────────────────────────────────────────────────────────────────────────
+
+struct no_storage_inverse {};
+
+template <class Inverse, class Sw> struct swizzled_inverse {
+  Inverse inverse;
+  [[nodiscard]] constexpr auto operator()(std::size_t p) const {
+    return inverse(Sw{}(p));
+  }
+};
+
+template <class L>
+[[nodiscard]] constexpr auto storage_inverse(L const &)
+    -> std::optional<no_storage_inverse> {
+  return std::nullopt;
+}
+
+template <class Shape, class Stride>
+[[nodiscard]] constexpr auto
+storage_inverse(cute::Layout<Shape, Stride> const &l)
+    -> std::optional<decltype(cute::right_inverse(l))> {
+  auto const inv = cute::right_inverse(l);
+  auto const n = static_cast<std::size_t>(cute::size(l));
+  if (static_cast<std::size_t>(cute::size(inv)) != n ||
+      static_cast<std::size_t>(cute::cosize(l)) != n)
+    return std::nullopt;
+  return inv;
+}
+
+template <int B, int M, int S, class Offset, class Shape, class Stride>
+[[nodiscard]] constexpr auto storage_inverse(
+    cute::ComposedLayout<cute::Swizzle<B, M, S>, Offset,
+                         cute::Layout<Shape, Stride>> const &l) {
+  using inner_inverse =
+      decltype(cute::right_inverse(cute::Layout<Shape, Stride>{}));
+  using result = swizzled_inverse<inner_inverse, cute::Swizzle<B, M, S>>;
+  if constexpr (!cute::is_constant<0, Offset>::value) {
+    return std::optional<result>{};
+  } else {
+    // The swizzle stays inside [0, n) only when n is a multiple of its period
+    constexpr std::size_t period = std::size_t{1}
+                                   << (B + M + (S < 0 ? -S : S));
+    auto const inner = storage_inverse(l.layout_b());
+    if (!inner ||
+        static_cast<std::size_t>(cute::size(l.layout_b())) % period != 0)
+      return std::optional<result>{};
+    return std::optional<result>{result{*inner}};
+  }
+}
+
+template <class Mapping>
+inline constexpr bool has_cute_layout_v =
+    requires(Mapping const &m) { m.cute_layout(); };
+
+template <class Mapping>
+[[nodiscard]] constexpr auto storage_inverse_of(Mapping const &m) {
+  if constexpr (has_cute_layout_v<Mapping>)
+    return storage_inverse(m.cute_layout());
+  else
+    return std::optional<no_storage_inverse>{};
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// nested_storage_order: stride order when the affine loop nest is monotone,
+// i.e. every stride covers the full span of the modes inside it
+// ─────────────────────────────────────────────────────────────────────────────
+
+template <class Mapping>
+[[nodiscard]] constexpr auto nested_storage_order(Mapping const &m)
+    -> std::optional<mode_order<Mapping::extents_type::rank()>> {
+  constexpr std::size_t R = Mapping::extents_type::rank();
+  auto const aff = affine_strides(m);
+  if (!aff)
+    return std::nullopt;
+  auto const order = stride_order(mode_strides(m));
+  std::ptrdiff_t span = 1;
+  for (std::size_t d = R; d-- > 0;) {
+    std::size_t const k = order[d];
+    auto const e = static_cast<std::ptrdiff_t>(m.extents().extent(k));
+    if (e <= 1)
+      continue;
+    if ((*aff)[k] < span)
+      return std::nullopt;
+    span = (*aff)[k] * e;
+  }
+  return order;
+}
+
+} // namespace detail
+
+// Strategy for_each_in_storage_order will use for this mapping
+template <class Mapping>
+[[nodiscard]] constexpr auto storage_walk_for(Mapping const &m)
+    -> storage_walk {
+  if (detail::storage_inverse_of(m))
+    return storage_walk::inverse;
+  if (detail::nested_storage_order(m))
+    return storage_walk::nested;
+  return storage_walk::sorted;
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// for_each_in_storage_order: f(coord, element) in increasing offset
+// Aliased elements (stride 0) are visited once per coordinate, ties broken by
+// colexicographic coordinate.
+// ═══════════════════════════════════════════════════════════════════════════════
+
+template <class T, class E, class L, class A, class F>
+void for_each_in_storage_order(std::mdspan<T, E, L, A> md, F f) {
+  using coord_type = index_array<E>;
+  using index_type = typename E::index_type;
+  constexpr std::size_t R = E::rank();
+
+  if (md.size() == 0)
+    return;
+  auto const visit = [&](coord_type const &c, std::size_t off) {
+    f(c, md.accessor().access(md.data_handle(), off));
+  };
+  if constexpr (R == 0) {
+    auto const off = detail::offset_at(md.mapping(), coord_type{});
+    visit(coord_type{}, static_cast<std::size_t>(off));
+    return;
+  } else {
+    auto const exts = detail::extents_array(md.extents());
+
+    // inverse: sequential offsets
+    if (auto const inv = detail::storage_inverse_of(md.mapping())) {
+      if constexpr (!std::is_same_v<std::remove_cvref_t<decltype(*inv)>,
+                                    detail::no_storage_inverse>) {
+        std::size_t const n = md.size();
+        for (std::size_t p = 0; p < n; ++p)
+          visit(detail::unflatten_colex(static_cast<std::size_t>((*inv)(p)),
+                                        exts),
+                p);
+        return;
+      }
+    }
+
+    // nested: stride-ordered loop nest with a pointer-stride inner run
+    if (auto const order = detail::nested_storage_order(md.mapping())) {
+      std::size_t const inner = (*order)[R - 1];
+      auto const step = (*detail::affine_strides(md.mapping()))[inner];
+      coord_type lo{}, c{};
+      auto run = [&](coord_type const &start) {
+        auto cc = start;
+        auto const base =
+            static_cast<std::ptrdiff_t>(detail::offset_at(md.mapping(), start));
+        for (index_type i = 0; i < exts[inner]; ++i) {
+          cc[inner] = i;
+          visit(cc, static_cast<std::size_t>(base + std::ptrdiff_t(i) * step));
+        }
+      };
+      detail::for_each_run(lo, exts, *order, c, run);
+      return;
+    }
+
+    // sorted: one (offset, linear index) table
+    std::vector<std::pair<std::size_t, std::size_t>> table;
+    table.reserve(md.size());
+    for_each_index(md.extents(), [&](coord_type const &c) {
+      table.emplace_back(
+          static_cast<std::size_t>(detail::offset_at(md.mapping(), c)),
+          detail::flatten_colex(c, exts));
+    });
+    std::sort(table.begin(), table.end());
+    for (auto const &[off, idx] : table)
+      visit(detail::unflatten_colex(idx, exts), off);
+  }
+}
+
+} // namespace mdspan_cute
@@ -0,0 +1,464 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// Copyright 2026 Weyl AI
+//
+// mdspan_cute/tile_cache.h
+//
+// Thread-safe LRU cache of relayouted tiles.
+//
+//   mdspan_cute::tile_cache cache(64 << 20);        // 64 MiB budget
+//   auto const sw = swizzle::make_swizzled_layout<swizzle::sw128>(
+//       cute::make_shape(cute::Int<64>{}, cute::Int<64>{}),
+//       cute::LayoutRight{});
+//   auto tile = cache.get(weights, tiler, {i, j}, sw); // relayout on miss
+//   use(tile.view());   // read-only layout_cute mdspan, pinned while held
+//
+// Entries are keyed by (source pointer, tile coordinate, target layout hash).
+// The layout hash covers the target layout's type, shape and strides, the
+// cached element type and, for get(), the source's mapping type and
+// extents and the tile extents, so one source cached under several tilings
+// or targets keeps separate entries. Layouts whose function object holds
+// runtime state (ragged, paged) are told apart by type and inner layout
+// only.
+//
+// The first get() of a key relayouts the tile outside the lock while other
+// callers of the same key wait for it, so each tile is repacked once no
+// matter how many threads ask. Tiles live in power-of-two blocks carved
+// from a bump_arena (arena.h) and are charged to the budget at block size.
+// When an insert would exceed the budget, unpinned tiles are evicted from
+// the least recently used end and their blocks reused by later tiles of the
+// same block size; pinned tiles are never evicted, so the cache may run over
+// budget while many handles are live; the excess is evicted by later
+// misses once those handles are gone. clear() drops every unpinned tile and,
+// once empty, returns the arena's memory.
+//
+// A handle pins its tile until destroyed; the cache must outlive its
+// handles.
+
+#pragma once
+
+#include <mdspan_cute/arena.h>
+#include <mdspan_cute/convert.h>
+#include <mdspan_cute/index_space.h>
+#include <mdspan_cute/layout_cute.h>
+#include <mdspan_cute/tile_iteration.h>
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <type_traits>
+#include <typeinfo>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <cute/layout.hpp>
+
+namespace mdspan_cute {
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Cache statistics
+// ═══════════════════════════════════════════════════════════════════════════════
+
+struct tile_cache_stats {
+  std::size_t hits = 0;
+  std::size_t misses = 0;         // each miss relayouts one tile
+  std::size_t evictions = 0;      // tiles dropped to stay under budget
+  std::size_t entries = 0;        // tiles currently cached
+  std::size_t resident_bytes = 0; // block bytes held by cached tiles
+  std::size_t arena_bytes = 0;    // arena capacity, free blocks included
+
+  [[nodiscard]] constexpr auto hit_rate() const noexcept -> double {
+    std::size_t const n = hits + misses;
+    return n ? static_cast<double>(hits) / static_cast<double>(n) : 0.0;
+  }
+
+  friend constexpr bool operator==(tile_cache_stats const &,
+                                   tile_cache_stats const &) = default;
+};
+
+// ═══════════════════════════════════════════════════════════════════════════════
+namespace detail {
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Layout hashing
+// ─────────────────────────────────────────────────────────────────────────────
+
+[[nodiscard]] constexpr auto hash_mix(std::size_t seed, std::size_t v) noexcept
+    -> std::size_t {
+  return seed ^ (v + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2));
+}
+
+template <class Flat>
+[[nodiscard]] constexpr auto hash_leaves(std::size_t seed, Flat const &flat)
+    -> std::size_t {
+  [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+    ((seed = hash_mix(seed, static_cast<std::size_t>(static_cast<std::int64_t>(
+                                cute::get<Is>(flat))))),
+     ...);
+  }(std::make_index_sequence<cute::tuple_size<Flat>::value>{});
+  return seed;
+}
+
+// Fallback: type and size only
+template <class L>
+[[nodiscard]] auto layout_hash(L const &l) -> std::size_t {
+  std::size_t seed = typeid(L).hash_code();
+  seed = hash_mix(seed, static_cast<std::size_t>(cute::size(l)));
+  return hash_mix(seed, static_cast<std::size_t>(cute::cosize(l)));
+}
+
+template <class Shape, class Stride>
+[[nodiscard]] auto layout_hash(cute::Layout<Shape, Stride> const &l)
+    -> std::size_t {
+  std::size_t seed = typeid(cute::Layout<Shape, Stride>).hash_code();
+  seed = hash_leaves(seed, flatten_shape(cute::shape(l)));
+  return hash_leaves(seed, flatten_shape(cute::stride(l)));
+}
+
+// Swizzles are static, so the type plus the inner layout and offset decide
+template <class A, class Offset, class B>
+[[nodiscard]] auto layout_hash(cute::ComposedLayout<A, Offset, B> const &l)
+    -> std::size_t {
+  std::size_t seed = typeid(cute::ComposedLayout<A, Offset, B>).hash_code();
+  seed = hash_mix(seed, layout_hash(l.layout_b()));
+  return hash_leaves(seed, flatten_shape(l.offset()));
+}
+
+// Target layout plus cached element type
+template <class D, class L>
+[[nodiscard]] auto tile_layout_hash(L const &l) -> std::size_t {
+  return hash_mix(layout_hash(l), typeid(D).hash_code());
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Keys and entries
+// ─────────────────────────────────────────────────────────────────────────────
+
+struct tile_key {
+  void const *source = nullptr;
+  std::size_t tile = 0;
+  std::size_t layout = 0;
+
+  friend bool operator==(tile_key const &, tile_key const &) = default;
+};
+
+struct tile_key_hash {
+  [[nodiscard]] auto operator()(tile_key const &k) const noexcept
+      -> std::size_t {
+    std::size_t seed = reinterpret_cast<std::uintptr_t>(k.source);
+    seed = hash_mix(seed, k.tile);
+    return hash_mix(seed, k.layout);
+  }
+};
+
+struct tile_entry {
+  tile_key key;
+  void *data = nullptr;
+  std::size_t block = 0; // block bytes charged to the budget
+  std::size_t pins = 0;  // live handles (plus the filling thread)
+  bool ready = false;    // false while the first caller fills it
+};
+
+// Power-of-two block holding `bytes`; aligned to its size up to a page
+[[nodiscard]] constexpr auto tile_block_bytes(std::size_t bytes) noexcept
+    -> std::size_t {
+  return std::bit_ceil(std::max(bytes, arena_vector_alignment));
+}
+
+[[nodiscard]] constexpr auto tile_block_alignment(std::size_t block) noexcept
+    -> std::size_t {
+  return std::min(block, arena_page_size);
+}
+
+} // namespace detail
+
+class tile_cache;
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// tile_handle: a pinned cached tile; view() is a read-only layout_cute mdspan
+// ═══════════════════════════════════════════════════════════════════════════════
+
+template <class D, class Target> class tile_handle {
+public:
+  using view_type = decltype(make_mdspan(std::declval<D const *>(),
+                                         std::declval<Target const &>()));
+
+  tile_handle(tile_handle &&other) noexcept
+      : cache_(std::exchange(other.cache_, nullptr)), entry_(other.entry_),
+        view_(other.view_) {}
+
+  auto operator=(tile_handle &&other) noexcept -> tile_handle & {
+    if (this != &other) {
+      reset();
+      cache_ = std::exchange(other.cache_, nullptr);
+      entry_ = other.entry_;
+      view_ = other.view_;
+    }
+    return *this;
+  }
+
+  tile_handle(tile_handle const &) = delete;
+  auto operator=(tile_handle const &) -> tile_handle & = delete;
+
+  ~tile_handle() { reset(); }
+
+  [[nodiscard]] auto view() const noexcept -> view_type const & {
+    return view_;
+  }
+  [[nodiscard]] auto data() const noexcept -> D const * {
+    return view_.data_handle();
+  }
+  [[nodiscard]] explicit operator bool() const noexcept {
+    return cache_ != nullptr;
+  }
+
+  // Unpin early; the view must not be used afterwards
+  void reset() noexcept;
+
+private:
+  friend class tile_cache;
+
+  tile_handle(tile_cache *cache, detail::tile_entry *entry,
+              view_type const &view) noexcept
+      : cache_(cache), entry_(entry), view_(view) {}
+
+  tile_cache *cache_ = nullptr;
+  detail::tile_entry *entry_ = nullptr;
+  view_type view_;
+};
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// tile_cache
+// ═══════════════════════════════════════════════════════════════════════════════
+
+class tile_cache {
+public:
+  explicit tile_cache(std::size_t budget_bytes,
+                      std::size_t chunk_bytes = arena_chunk_bytes)
+      : budget_(budget_bytes), arena_(chunk_bytes) {}
+
+  tile_cache(tile_cache const &) = delete;
+  auto operator=(tile_cache const &) -> tile_cache & = delete;
+
+  ~tile_cache() {
+    assert(std::ranges::none_of(
+               lru_, [](auto const &e) { return e.pins > 0; }) &&
+           "mdspan_cute::tile_cache: destroyed with live handles");
+  }
+
+  // ─────────────────────────────────────────────────────────────────────
+  // Lookup
+  // ─────────────────────────────────────────────────────────────────────
+
+  // Tile `tile` of `source` in layout `target`. On a miss, fill(dst) is
+  // called once with a writable make_mdspan(D*, target) to produce it.
+  template <class D, cute_layout Target, class Fill>
+  auto get_or_fill(void const *source, std::size_t tile, Target const &target,
+                   Fill &&fill) -> tile_handle<D, Target> {
+    return lookup<D>({source, tile, detail::tile_layout_hash<D>(target)},
+                     target, fill);
+  }
+
+  // Tile t of src split by tiler, relayouted into target (whose flattened
+  // shape is the full tile) and converted to D (default: src's value type).
+  // Positions of a clipped edge tile past the source are zero.
+  template <class D = void, class TS, class ES, class LS, class AS,
+            class Tiler, cute_layout Target>
+  auto get(std::mdspan<TS, ES, LS, AS> src, Tiler const &tiler,
+           index_array<ES> const &t, Target const &target) {
+    using value_type =
+        std::conditional_t<std::is_void_v<D>, std::remove_cv_t<TS>, D>;
+    static_assert(detail::cute_layout_flat_rank_v<Target> == ES::rank(),
+                  "mdspan_cute::tile_cache::get: target rank must match "
+                  "the source rank");
+    tile_split const split(src.extents(), tiler);
+    auto const &counts = split.tile_counts();
+    auto const &tile_ext = split.tile_extents();
+
+    // Row-major tile number; the tiling itself goes into the layout hash
+    std::size_t linear = 0;
+    std::size_t seed = detail::hash_mix(
+        detail::tile_layout_hash<value_type>(target),
+        typeid(typename LS::template mapping<ES>).hash_code());
+    for (std::size_t k = 0; k < ES::rank(); ++k) {
+      assert(t[k] < counts[k] && "mdspan_cute::tile_cache::get: tile out of "
+                                 "range");
+      linear = linear * static_cast<std::size_t>(counts[k]) +
+               static_cast<std::size_t>(t[k]);
+      seed = detail::hash_mix(seed, static_cast<std::size_t>(src.extent(k)));
+      seed = detail::hash_mix(seed, static_cast<std::size_t>(tile_ext[k]));
+      if constexpr (LS::template mapping<ES>::is_always_strided())
+        seed = detail::hash_mix(
+            seed, static_cast<std::size_t>(src.mapping().stride(k)));
+    }
+
+    auto fill = [&](auto dst) {
+      for (std::size_t k = 0; k < ES::rank(); ++k)
+        assert(static_cast<std::size_t>(dst.extent(k)) ==
+                   static_cast<std::size_t>(tile_ext[k]) &&
+               "mdspan_cute::tile_cache::get: target shape != tile shape");
+      if (!split.is_interior(t))
+        for_each_index(dst.extents(), [&](auto const &l) {
+          detail::element_at(dst, l) = value_type{};
+        });
+      auto const lo = split.tile_begin(t), hi = split.tile_end(t);
+      index_array<ES> c{};
+      auto body = [&](index_array<ES> const &g) {
+        index_array<ES> l{};
+        for (std::size_t k = 0; k < ES::rank(); ++k)
+          l[k] = g[k] - lo[k];
+        detail::element_at(dst, l) =
+            convert_to<value_type>{}(detail::element_at(src, g));
+      };
+      detail::for_each_in_box(lo, hi, c, body);
+    };
+    return lookup<value_type>(
+        {static_cast<void const *>(src.data_handle()), linear, seed}, target,
+        fill);
+  }
+
+  // ─────────────────────────────────────────────────────────────────────
+  // Observers and maintenance
+  // ─────────────────────────────────────────────────────────────────────
+
+  [[nodiscard]] auto budget() const noexcept -> std::size_t {
+    return budget_;
+  }
+
+  [[nodiscard]] auto stats() const -> tile_cache_stats {
+    std::lock_guard const lock(mutex_);
+    tile_cache_stats s = stats_;
+    s.entries = lru_.size();
+    s.resident_bytes = resident_;
+    s.arena_bytes = arena_.capacity();
+    return s;
+  }
+
+  // Drop every unpinned tile; release the arena once nothing is cached
+  void clear() {
+    std::lock_guard const lock(mutex_);
+    for (auto it = lru_.begin(); it != lru_.end();)
+      it = it->pins == 0 ? drop(it) : std::next(it);
+    if (lru_.empty()) {
+      free_.clear();
+      arena_.release();
+    }
+  }
+
+private:
+  template <class, class> friend class tile_handle;
+
+  using entry_list = std::list<detail::tile_entry>;
+
+  template <class D, class Target, class Fill>
+  auto lookup(detail::tile_key const &key, Target const &target, Fill &fill)
+      -> tile_handle<D, Target> {
+    static_assert(std::is_trivially_default_constructible_v<D> &&
+                      std::is_trivially_destructible_v<D>,
+                  "mdspan_cute::tile_cache: arena memory is uninitialized "
+                  "and never destroyed");
+    std::unique_lock lock(mutex_);
+    for (auto it = index_.find(key); it != index_.end();
+         it = index_.find(key)) {
+      auto const e = it->second;
+      if (e->ready) {
+        ++stats_.hits;
+        ++e->pins;
+        lru_.splice(lru_.begin(), lru_, e);
+        return {this, &*e,
+                make_mdspan(static_cast<D const *>(e->data), target)};
+      }
+      // Another thread is filling this tile; the entry may also vanish if
+      // its fill throws, in which case this caller fills it instead
+      ready_.wait(lock);
+    }
+
+    ++stats_.misses;
+    auto const bytes = static_cast<std::size_t>(cute::cosize(target)) *
+                       sizeof(D);
+    std::size_t const block = detail::tile_block_bytes(bytes);
+    assert(layout_alignment<D>(target) <=
+               detail::tile_block_alignment(block) &&
+           "mdspan_cute::tile_cache: swizzle period exceeds the tile");
+    make_room(block);
+    lru_.push_front({key, take_block(block), block, 1, false});
+    auto const e = lru_.begin();
+    index_.emplace(key, e);
+    resident_ += block;
+    lock.unlock();
+
+    try {
+      fill(make_mdspan(static_cast<D *>(e->data), target));
+    } catch (...) {
+      lock.lock();
+      drop(e);
+      lock.unlock();
+      ready_.notify_all();
+      throw;
+    }
+
+    lock.lock();
+    e->ready = true;
+    lock.unlock();
+    ready_.notify_all();
+    return {this, &*e, make_mdspan(static_cast<D const *>(e->data), target)};
+  }
+
+  void unpin(detail::tile_entry *e) noexcept {
+    std::lock_guard const lock(mutex_);
+    assert(e->pins > 0);
+    --e->pins;
+  }
+
+  // Evict unpinned ready tiles, oldest first, until `block` more bytes fit
+  void make_room(std::size_t block) {
+    for (auto it = lru_.end(); resident_ + block > budget_ &&
+                               it != lru_.begin();) {
+      --it;
+      if (it->pins == 0 && it->ready) {
+        ++stats_.evictions;
+        it = drop(it);
+      }
+    }
+  }
+
+  auto drop(entry_list::iterator it) -> entry_list::iterator {
+    index_.erase(it->key);
+    free_[it->block].push_back(it->data);
+    resident_ -= it->block;
+    return lru_.erase(it);
+  }
+
+  auto take_block(std::size_t block) -> void * {
+    if (auto f = free_.find(block); f != free_.end() && !f->second.empty()) {
+      void *p = f->second.back();
+      f->second.pop_back();
+      return p;
+    }
+    return arena_.allocate(block, detail::tile_block_alignment(block));
+  }
+
+  mutable std::mutex mutex_;
+  std::condition_variable ready_;
+  std::size_t budget_;
+  std::size_t resident_ = 0;
+  tile_cache_stats stats_;
+  bump_arena arena_;
+  entry_list lru_; // most recently used first
+  std::unordered_map<detail::tile_key, entry_list::iterator,
+                     detail::tile_key_hash>
+      index_;
+  std::unordered_map<std::size_t, std::vector<void *>> free_; // by block size
+};
+
+template <class D, class Target> void tile_handle<D, Target>::reset() noexcept {
+  if (cache_)
+    std::exchange(cache_, nullptr)->unpin(entry_);
+}
+
+} // namespace mdspan_cute
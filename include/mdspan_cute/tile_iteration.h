@@ -0,0 +1,247 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// Copyright 2026 Weyl AI
+//
+// mdspan_cute/tile_iteration.h
+//
+// Predication-free tiled iteration over layout_cute mdspans.
+//
+// Splitting a mode of extent N by a tile of extent T yields ⌈N/T⌉ tiles and
+// ⌈N/T⌉·T − N holes (proof/doc/reading/divisibility-of-split.md). Rather than
+// bounds-checking every access, the tile space is peeled into:
+//
+//   interior  – tiles whose index is below ⌊N/T⌋ in every mode; no element of
+//               such a tile can be out of bounds, so the loop has no branches
+//   remainder – the tiles on an indivisible edge; their loop bounds are
+//               clipped once per tile instead of predicating each element
+//
+// Usage:
+//   auto stats = mdspan_cute::for_each_tiled(
+//       md, cute::make_shape(cute::Int<8>{}, cute::Int<8>{}),
+//       [](auto const &coord, float &x) { x *= 2.0f; });
+//   // stats.remainder_tiles, stats.holes for profiling
+
+#pragma once
+
+#include <mdspan_cute/index_space.h>
+#include <mdspan_cute/layout_cute.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace mdspan_cute {
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Iteration statistics (exposed for profiling)
+// ═══════════════════════════════════════════════════════════════════════════════
+
+struct tile_iteration_stats {
+  std::size_t interior_tiles = 0;     // tiles run without any predicate
+  std::size_t remainder_tiles = 0;    // tiles with clipped loop bounds
+  std::size_t remainder_elements = 0; // in-bound elements of remainder tiles
+  std::size_t holes = 0;              // positions clipped away (Split holes)
+
+  friend constexpr bool operator==(tile_iteration_stats const &,
+                                   tile_iteration_stats const &) = default;
+};
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// tile_split: per-mode Split(N_k, T_k) and the interior/remainder partition
+// ═══════════════════════════════════════════════════════════════════════════════
+//
+// For a tile index t < ⌊N/T⌋ every element index is i = t·T + r with r < T,
+// so i / T = t < ⌊N/T⌋. By Theorem 2.16 (i / d < D ⟺ i < D·d) this gives
+// i < ⌊N/T⌋·T ≤ N: the whole tile is in bounds and needs no predicate.
+// Theorems 4.12–4.13 make the digit split i = (i / T)·T + i % T exact, so the
+// remainder tile of a mode covers exactly N % T in-bound indices and
+// T − N % T holes, matching Split::num_holes in tests/property_tests.cpp.
+
+template <class Extents, class Tiler> class tile_split {
+public:
+  using extents_type = Extents;
+  using index_type = typename extents_type::index_type;
+  using coord_type = index_array<extents_type>;
+  using tiler_type = Tiler;
+
+  static constexpr std::size_t rank = extents_type::rank();
+
+  static_assert(cute::tuple_size<Tiler>::value == rank,
+                "mdspan_cute::tile_split: rank(tiler) != rank(extents)");
+
+private:
+  [[no_unique_address]] Tiler tiler_{};
+  coord_type extent_{};
+  coord_type tile_{};
+  coord_type tiles_{}; // ⌈N/T⌉ per mode
+  coord_type full_{};  // ⌊N/T⌋ per mode
+
+public:
+  constexpr tile_split(extents_type const &exts, Tiler const &tiler)
+      : tiler_(tiler), extent_(detail::extents_array(exts)) {
+    [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+      ((tile_[Is] = static_cast<index_type>(
+            detail::to_size_t(cute::get<Is>(tiler_)))),
+       ...);
+    }(std::make_index_sequence<rank>{});
+
+    for (std::size_t k = 0; k < rank; ++k) {
+      assert(tile_[k] > 0);
+      full_[k] = extent_[k] / tile_[k];
+      tiles_[k] = (extent_[k] + tile_[k] - 1) / tile_[k];
+    }
+  }
+
+  // ─────────────────────────────────────────────────────────────────────
+  // Observers
+  // ─────────────────────────────────────────────────────────────────────
+
+  [[nodiscard]] constexpr auto tiler() const noexcept -> Tiler const & {
+    return tiler_;
+  }
+  [[nodiscard]] constexpr auto tile_extents() const noexcept
+      -> coord_type const & {
+    return tile_;
+  }
+  [[nodiscard]] constexpr auto tile_counts() const noexcept
+      -> coord_type const & {
+    return tiles_;
+  }
+  [[nodiscard]] constexpr auto full_tile_counts() const noexcept
+      -> coord_type const & {
+    return full_;
+  }
+
+  [[nodiscard]] constexpr bool is_divisible() const noexcept {
+    return full_ == tiles_;
+  }
+
+  // True when no element of tile t can fall outside the extents
+  [[nodiscard]] constexpr bool is_interior(coord_type const &t) const noexcept {
+    for (std::size_t k = 0; k < rank; ++k)
+      if (t[k] >= full_[k])
+        return false;
+    return true;
+  }
+
+  // Clipped upper bound of tile t (first index past the tile, per mode)
+  [[nodiscard]] constexpr auto tile_end(coord_type const &t) const noexcept
+      -> coord_type {
+    coord_type hi{};
+    for (std::size_t k = 0; k < rank; ++k)
+      hi[k] = std::min<index_type>((t[k] + 1) * tile_[k], extent_[k]);
+    return hi;
+  }
+
+  [[nodiscard]] constexpr auto tile_begin(coord_type const &t) const noexcept
+      -> coord_type {
+    coord_type lo{};
+    for (std::size_t k = 0; k < rank; ++k)
+      lo[k] = t[k] * tile_[k];
+    return lo;
+  }
+
+  // ─────────────────────────────────────────────────────────────────────
+  // Analytic counts (no iteration needed)
+  // ─────────────────────────────────────────────────────────────────────
+
+  [[nodiscard]] constexpr auto stats() const noexcept -> tile_iteration_stats {
+    std::size_t tiles = 1, interior = 1, elements = 1, tile_volume = 1;
+    for (std::size_t k = 0; k < rank; ++k) {
+      tiles *= static_cast<std::size_t>(tiles_[k]);
+      interior *= static_cast<std::size_t>(full_[k]);
+      elements *= static_cast<std::size_t>(extent_[k]);
+      tile_volume *= static_cast<std::size_t>(tile_[k]);
+    }
+    std::size_t const interior_elements = interior * tile_volume;
+
+    tile_iteration_stats s;
+    s.interior_tiles = interior;
+    s.remainder_tiles = tiles - interior;
+    s.remainder_elements = elements - interior_elements;
+    s.holes = tiles * tile_volume - elements;
+    return s;
+  }
+};
+
+template <class Extents, class Tiler>
+tile_split(Extents const &, Tiler const &) -> tile_split<Extents, Tiler>;
+
+// ═══════════════════════════════════════════════════════════════════════════════
+namespace detail {
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Full (interior) tile: loop bounds come straight from the tiler, so static
+// cute::Int<N> tile modes become constant trip counts the compiler unrolls.
+// ─────────────────────────────────────────────────────────────────────────────
+
+template <std::size_t K, class MDSpan, class Tiler, class Coord, class F>
+constexpr void visit_full_tile(MDSpan const &md, Tiler const &tiler,
+                               Coord const &base, Coord &c, F &f) {
+  using index_type = typename MDSpan::index_type;
+  if constexpr (K == MDSpan::rank()) {
+    f(std::as_const(c), element_at(md, c));
+  } else {
+    using tile_k = std::remove_cvref_t<decltype(cute::get<K>(tiler))>;
+    if constexpr (cute_extent_is_static_v<tile_k>) {
+      constexpr auto T =
+          static_cast<index_type>(cute_static_extent_value<tile_k>::value);
+      for (index_type r = 0; r < T; ++r) {
+        c[K] = base[K] + r;
+        visit_full_tile<K + 1>(md, tiler, base, c, f);
+      }
+    } else {
+      auto const T = static_cast<index_type>(to_size_t(cute::get<K>(tiler)));
+      for (index_type r = 0; r < T; ++r) {
+        c[K] = base[K] + r;
+        visit_full_tile<K + 1>(md, tiler, base, c, f);
+      }
+    }
+  }
+}
+
+} // namespace detail
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// for_each_tiled: interior tiles branch-free, then the predicated remainder
+// f(coord, element) is called exactly once per in-bound element
+// ═══════════════════════════════════════════════════════════════════════════════
+
+template <class T, class Extents, class Layout, class Accessor, class Tiler,
+          class F>
+constexpr auto for_each_tiled(std::mdspan<T, Extents, Layout, Accessor> md,
+                              Tiler const &tiler, F &&f)
+    -> tile_iteration_stats {
+  using coord_type = index_array<Extents>;
+
+  tile_split const split(md.extents(), tiler);
+
+  // Interior: the box [0, ⌊N/T⌋) of tiles, no bounds checks anywhere
+  coord_type const zero{};
+  coord_type t{};
+  coord_type c{};
+  auto interior = [&](coord_type const &tile) {
+    auto const base = split.tile_begin(tile);
+    detail::visit_full_tile<0>(md, split.tiler(), base, c, f);
+  };
+  detail::for_each_in_box(zero, split.full_tile_counts(), t, interior);
+
+  // Remainder: tiles on an indivisible edge, bounds clipped per tile
+  if (!split.is_divisible()) {
+    auto remainder = [&](coord_type const &tile) {
+      if (split.is_interior(tile))
+        return;
+      auto const lo = split.tile_begin(tile);
+      auto const hi = split.tile_end(tile);
+      auto body = [&](coord_type const &e) {
+        f(e, detail::element_at(md, e));
+      };
+      detail::for_each_in_box(lo, hi, c, body);
+    };
+    detail::for_each_in_box(zero, split.tile_counts(), t, remainder);
+  }
+
+  return split.stats();
+}
+
+} // namespace mdspan_cute
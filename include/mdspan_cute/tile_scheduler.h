@@ -0,0 +1,266 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// Copyright 2026 Weyl AI
+//
+// mdspan_cute/tile_scheduler.h
+//
+// Work-stealing tile scheduler with stream-K tail balancing.
+//
+//   auto stats = mdspan_cute::schedule_tiles(
+//       md, cute::make_shape(cute::Int<64>{}, cute::Int<64>{}),
+//       [&](auto const &work) {
+//         for_each_in_work(md, work, [](auto const &c, float &x) { ... });
+//       });
+//   // stats.workers[w].busy_ns / idle_ns per worker
+//
+// Tiles come from tile_split (tile_iteration.h), so ragged edge tiles are
+// clipped once per tile. With N tiles on W workers, the first N − N mod W
+// tiles run whole ("data-parallel" waves). Left alone, the last N mod W tiles
+// form a partial wave that a few cores finish while the rest sit idle. Those
+// tiles are instead cut along their widest mode and redistributed so each
+// worker gets an equal number of rows; a piece may cross a tile boundary, as
+// in stream-K. Every worker starts with a contiguous block of whole tiles
+// followed by its tail piece.
+//
+// Each worker owns a mutex-protected deque. It pops its own work from the
+// front (in tile order, for locality) and steals from the back of other
+// deques when it runs dry. Per-worker busy/idle nanoseconds, task counts and
+// steals are returned for profiling.
+
+#pragma once
+
+#include <mdspan_cute/index_space.h>
+#include <mdspan_cute/layout_cute.h>
+#include <mdspan_cute/parallel.h>
+#include <mdspan_cute/tile_iteration.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace mdspan_cute {
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// Work items, options and statistics
+// ═══════════════════════════════════════════════════════════════════════════════
+
+// One unit of scheduled work: the box [begin, end) of tile `tile`. `partial`
+// marks a stream-K piece covering only some rows of the tile.
+template <class Extents> struct tile_work {
+  using coord_type = index_array<Extents>;
+
+  coord_type tile{};
+  coord_type begin{};
+  coord_type end{};
+  bool partial = false;
+
+  [[nodiscard]] constexpr auto size() const noexcept -> std::size_t {
+    std::size_t n = 1;
+    for (std::size_t k = 0; k < Extents::rank(); ++k)
+      n *= static_cast<std::size_t>(end[k] - begin[k]);
+    return n;
+  }
+};
+
+struct tile_schedule_options {
+  std::size_t num_threads = default_num_threads();
+  bool stream_k = true; // split the partial last wave
+  bool pin = false;     // pin workers to cores
+};
+
+struct tile_worker_stats {
+  std::uint64_t busy_ns = 0; // inside the tile callback
+  std::uint64_t idle_ns = 0; // looking for work
+  std::size_t tasks = 0;
+  std::size_t steals = 0;
+};
+
+struct tile_schedule_stats {
+  std::size_t tiles = 0;          // tiles in the split
+  std::size_t stream_k_tiles = 0; // tiles cut into pieces
+  std::size_t tasks = 0;          // work items after splitting
+  std::vector<tile_worker_stats> workers;
+};
+
+// f(coord, element) over the box of one work item
+template <class T, class E, class L, class A, class G>
+constexpr void for_each_in_work(std::mdspan<T, E, L, A> const &md,
+                                tile_work<E> const &work, G &&g) {
+  index_array<E> c{};
+  auto body = [&](index_array<E> const &e) {
+    g(e, detail::element_at(md, e));
+  };
+  detail::for_each_in_box(work.begin, work.end, c, body);
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+namespace detail {
+
+template <class Task> struct alignas(64) work_deque {
+  std::mutex mutex;
+  std::deque<Task> tasks;
+
+  auto pop_front() -> std::optional<Task> {
+    std::lock_guard lock(mutex);
+    if (tasks.empty())
+      return std::nullopt;
+    Task t = std::move(tasks.front());
+    tasks.pop_front();
+    return t;
+  }
+
+  auto steal_back() -> std::optional<Task> {
+    std::lock_guard lock(mutex);
+    if (tasks.empty())
+      return std::nullopt;
+    Task t = std::move(tasks.back());
+    tasks.pop_back();
+    return t;
+  }
+};
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Plan: whole tiles in blocks per worker, then stream-K pieces of the tail
+// ─────────────────────────────────────────────────────────────────────────────
+
+template <class Extents, class Tiler>
+auto plan_tile_work(tile_split<Extents, Tiler> const &split,
+                    std::size_t workers, bool stream_k)
+    -> std::pair<std::vector<std::vector<tile_work<Extents>>>, std::size_t> {
+  using work_type = tile_work<Extents>;
+  using coord_type = typename work_type::coord_type;
+  using index_type = typename Extents::index_type;
+
+  std::vector<coord_type> tiles;
+  coord_type const zero{};
+  coord_type t{};
+  auto collect = [&](coord_type const &tile) { tiles.push_back(tile); };
+  for_each_in_box(zero, split.tile_counts(), t, collect);
+
+  std::size_t const n = tiles.size();
+  std::size_t const tail = stream_k ? n % workers : 0;
+  std::size_t const whole = n - tail;
+
+  std::vector<std::vector<work_type>> queues(workers);
+  for (std::size_t i = 0; i < whole; ++i) {
+    auto &q = queues[i * workers / std::max<std::size_t>(1, whole)];
+    q.push_back(work_type{tiles[i], split.tile_begin(tiles[i]),
+                          split.tile_end(tiles[i]), false});
+  }
+  if (tail == 0)
+    return {std::move(queues), 0};
+
+  // Cut along the mode with the widest tile; rows are indices of that mode
+  auto const &te = split.tile_extents();
+  std::size_t const mode = static_cast<std::size_t>(
+      std::max_element(te.begin(), te.end()) - te.begin());
+
+  std::vector<std::size_t> first_row(tail + 1, 0); // prefix sum of rows
+  for (std::size_t i = 0; i < tail; ++i) {
+    auto const &tile = tiles[whole + i];
+    first_row[i + 1] =
+        first_row[i] + static_cast<std::size_t>(split.tile_end(tile)[mode] -
+                                                split.tile_begin(tile)[mode]);
+  }
+  std::size_t const rows = first_row[tail];
+
+  for (std::size_t w = 0; w < workers; ++w) {
+    std::size_t const lo = rows * w / workers, hi = rows * (w + 1) / workers;
+    for (std::size_t i = 0; i < tail; ++i) {
+      std::size_t const a = std::max(lo, first_row[i]);
+      std::size_t const b = std::min(hi, first_row[i + 1]);
+      if (a >= b)
+        continue;
+      auto const &tile = tiles[whole + i];
+      work_type piece{tile, split.tile_begin(tile), split.tile_end(tile)};
+      auto const base = piece.begin[mode];
+      piece.begin[mode] = base + static_cast<index_type>(a - first_row[i]);
+      piece.end[mode] = base + static_cast<index_type>(b - first_row[i]);
+      piece.partial = (b - a) != first_row[i + 1] - first_row[i];
+      queues[w].push_back(piece);
+    }
+  }
+  return {std::move(queues), tail};
+}
+
+} // namespace detail
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// schedule_tiles: run f(tile_work) for every tile of md on a work-stealing pool
+// ═══════════════════════════════════════════════════════════════════════════════
+
+template <class T, class E, class L, class A, class Tiler, class F>
+auto schedule_tiles(std::mdspan<T, E, L, A> md, Tiler const &tiler, F f,
+                    tile_schedule_options const &opts = {})
+    -> tile_schedule_stats {
+  using work_type = tile_work<E>;
+  using clock = std::chrono::steady_clock;
+
+  tile_split const split(md.extents(), tiler);
+  std::size_t const workers = std::max<std::size_t>(1, opts.num_threads);
+  auto [plan, tail] = detail::plan_tile_work(split, workers, opts.stream_k);
+
+  tile_schedule_stats stats;
+  stats.stream_k_tiles = tail;
+  stats.workers.resize(workers);
+
+  std::vector<detail::work_deque<work_type>> queues(workers);
+  for (std::size_t w = 0; w < workers; ++w) {
+    stats.tasks += plan[w].size();
+    queues[w].tasks.assign(plan[w].begin(), plan[w].end());
+  }
+  {
+    auto const counts = split.tile_counts();
+    stats.tiles = 1;
+    for (auto c : counts)
+      stats.tiles *= static_cast<std::size_t>(c);
+  }
+  std::atomic<std::size_t> pending{stats.tasks};
+
+  run_workers(workers, opts.pin, [&](std::size_t w) {
+    auto &ws = stats.workers[w];
+    auto const start = clock::now();
+    std::uint64_t busy = 0;
+
+    while (true) {
+      auto task = queues[w].pop_front();
+      for (std::size_t i = 1; !task && i < workers; ++i) {
+        task = queues[(w + i) % workers].steal_back();
+        ws.steals += task.has_value();
+      }
+      if (!task) {
+        if (pending.load(std::memory_order_acquire) == 0)
+          break;
+        std::this_thread::yield();
+        continue;
+      }
+      pending.fetch_sub(1, std::memory_order_acq_rel);
+
+      auto const t0 = clock::now();
+      f(std::as_const(*task));
+      busy += static_cast<std::uint64_t>(
+          std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() -
+                                                               t0)
+              .count());
+      ++ws.tasks;
+    }
+
+    auto const total = static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() -
+                                                             start)
+            .count());
+    ws.busy_ns = busy;
+    ws.idle_ns = total > busy ? total - busy : 0;
+  });
+
+  return stats;
+}
+
+} // namespace mdspan_cute
@@ -0,0 +1,356 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// Copyright 2026 Weyl AI
+//
+// mdspan_cute/transform.h
+//
+// Fused multi-operand elementwise kernels.
+//
+//   transform(out, f, in0, in1, ...)      // out[c] = f(in0[c], in1[c], ...)
+//
+// All operands share extents but may have different layouts (row-major
+// output, swizzled input, transposed input, ...). Like TensorIterator's
+// dimension reordering, the engine sums the per-mode strides of every
+// operand and loops the cheapest mode innermost. When every operand is
+// affine, inner modes that are contiguous in all operands are coalesced into
+// a single run, and the run is executed as a pointer loop (unit stride in all
+// operands vectorizes). The outermost remaining mode is split across threads.
+// Non-affine operands (swizzles) keep the stride-cost order but resolve each
+// element through their mapping.
+//
+// Loop order alone cannot help when operands disagree on their innermost
+// mode (row-major output, transposed input): one of them strides a full row
+// per element. The engine then blocks over the two modes instead, reusing
+// permute_copy's two-level (a, b) tiling (permute.h): `b` is innermost in
+// the output and `a` in the disagreeing input. L2 blocks are split across
+// threads, and inside each 8×8 micro-tile the output streams along `b`
+// while the input's cache lines along `a` stay resident.
+
+#pragma once
+
+#include <mdspan_cute/index_space.h>
+#include <mdspan_cute/layout_cute.h>
+#include <mdspan_cute/loop_order.h>
+#include <mdspan_cute/parallel.h>
+#include <mdspan_cute/permute.h>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace mdspan_cute {
+
+// ═══════════════════════════════════════════════════════════════════════════════
+namespace detail {
+
+template <class T> inline constexpr bool is_mdspan_v = false;
+
+template <class T, class E, class L, class A>
+inline constexpr bool is_mdspan_v<std::mdspan<T, E, L, A>> = true;
+
+template <class T>
+concept any_mdspan = is_mdspan_v<std::remove_cvref_t<T>>;
+
+constexpr std::size_t saturating_add(std::size_t a, std::size_t b) noexcept {
+  return a > std::numeric_limits<std::size_t>::max() - b
+             ? std::numeric_limits<std::size_t>::max()
+             : a + b;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Loop plan shared by all operands: mode order, coalesced inner run
+// ─────────────────────────────────────────────────────────────────────────────
+
+template <std::size_t R, std::size_t N> struct elementwise_plan {
+  mode_order<R> order{};
+  std::size_t run_modes = 1; // innermost modes folded into the run
+  std::size_t run_len = 0;   // elements per run
+  bool affine = false;       // all operands affine
+  bool blocked = false;      // operands disagree on the innermost mode
+  permute_plan<R> tiles{};   // tiled modes when blocked
+  std::array<std::array<std::ptrdiff_t, R>, N> strides{};
+};
+
+template <std::size_t R, class... Mappings>
+auto make_elementwise_plan(std::array<std::size_t, R> const &exts,
+                           Mappings const &...maps)
+    -> elementwise_plan<R, sizeof...(Mappings)> {
+  constexpr std::size_t N = sizeof...(Mappings);
+  elementwise_plan<R, N> plan;
+
+  // Total stride cost per mode across operands
+  std::array<stride_array<R>, N> const s{mode_strides(maps)...};
+  stride_array<R> cost{};
+  for (std::size_t k = 0; k < R; ++k)
+    for (std::size_t op = 0; op < N; ++op)
+      cost[k] = saturating_add(cost[k], s[op][k]);
+  plan.order = stride_order(cost);
+
+  // Block when an input strides along the output's innermost mode b but has
+  // a smaller (non-broadcast) stride along another mode a
+  if constexpr (R >= 2) {
+    auto const out_order = stride_order(s[0]);
+    std::size_t const b = out_order[R - 1];
+    for (std::size_t op = 1; op < N && !plan.blocked && exts[b] > 1; ++op) {
+      std::size_t a = b;
+      for (std::size_t k = 0; k < R; ++k)
+        if (k != b && exts[k] > 1 && s[op][k] != 0 &&
+            (a == b || s[op][k] < s[op][a]))
+          a = k;
+      if (a == b || s[op][a] >= s[op][b])
+        continue;
+      plan.blocked = true;
+      plan.tiles.a = a;
+      plan.tiles.b = b;
+      for (std::size_t d = R; d-- > 0;)
+        if (out_order[d] != a && out_order[d] != b)
+          plan.tiles.outer[plan.tiles.outer_count++] = out_order[d];
+    }
+  }
+
+  std::array<std::optional<std::array<std::ptrdiff_t, R>>, N> const aff{
+      affine_strides(maps)...};
+  plan.affine = true;
+  for (std::size_t op = 0; op < N; ++op) {
+    if (!aff[op]) {
+      plan.affine = false;
+      break;
+    }
+    plan.strides[op] = *aff[op];
+  }
+
+  std::size_t const inner = plan.order[R - 1];
+  plan.run_len = exts[inner];
+  if (!plan.affine)
+    return plan;
+
+  // Coalesce: mode k folds into the run when, for every operand,
+  // stride(k) == extent(prev) · stride(prev) with prev the next-inner mode
+  while (plan.run_modes < R) {
+    std::size_t const k = plan.order[R - 1 - plan.run_modes];
+    std::size_t const prev = plan.order[R - plan.run_modes];
+    bool contiguous = true;
+    for (std::size_t op = 0; op < N && contiguous; ++op)
+      contiguous = plan.strides[op][k] ==
+                   plan.strides[op][prev] * std::ptrdiff_t(exts[prev]);
+    if (!contiguous)
+      break;
+    plan.run_len *= exts[k];
+    ++plan.run_modes;
+  }
+  return plan;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Engine
+// ─────────────────────────────────────────────────────────────────────────────
+
+template <class Out, class F, class... Ins>
+void transform_impl(std::size_t num_threads, Out const &out, F &f,
+                    Ins const &...ins) {
+  constexpr std::size_t R = Out::rank();
+  constexpr std::size_t N = 1 + sizeof...(Ins);
+  static_assert(((Ins::rank() == R) && ...),
+                "mdspan_cute::transform: operand ranks differ");
+  using index_type = typename Out::index_type;
+  using coord_type = index_array<typename Out::extents_type>;
+
+  auto const exts = extents_array(out.extents());
+  std::array<std::size_t, R> ext{};
+  for (std::size_t k = 0; k < R; ++k) {
+    ext[k] = static_cast<std::size_t>(exts[k]);
+    assert(((static_cast<std::size_t>(ins.extent(k)) == ext[k]) && ...));
+  }
+  if (out.size() == 0)
+    return;
+
+  if constexpr (R == 0) {
+    out[] = f(ins[]...);
+    return;
+  } else {
+    auto const plan =
+        make_elementwise_plan(ext, out.mapping(), ins.mapping()...);
+    std::tuple<Ins const &...> const in_t{ins...};
+    std::size_t const inner = plan.order[R - 1];
+
+    // Operand coordinates → per-operand element offsets
+    auto offsets = [&](coord_type const &c) {
+      return std::array<std::ptrdiff_t, N>{
+          static_cast<std::ptrdiff_t>(offset_at(out.mapping(), c)),
+          static_cast<std::ptrdiff_t>(offset_at(ins.mapping(), c))...};
+    };
+
+    using offsets_type = std::array<std::ptrdiff_t, N>;
+    auto apply = [&]<std::size_t... Is>(std::index_sequence<Is...>,
+                                        offsets_type const &o) {
+      out.accessor().access(out.data_handle(),
+                            static_cast<std::size_t>(o[0])) =
+          f(std::get<Is>(in_t).accessor().access(
+              std::get<Is>(in_t).data_handle(),
+              static_cast<std::size_t>(o[Is + 1]))...);
+    };
+    auto const in_seq = std::index_sequence_for<Ins...>{};
+
+    // One run of `len` elements starting `begin` elements into the run
+    auto run = [&](coord_type const &c, std::size_t begin, std::size_t len) {
+      if (plan.affine) {
+        auto base = offsets(c);
+        std::array<std::ptrdiff_t, N> step{};
+        bool unit = true;
+        for (std::size_t op = 0; op < N; ++op) {
+          step[op] = plan.strides[op][inner];
+          base[op] += std::ptrdiff_t(begin) * step[op];
+          unit = unit && step[op] == 1;
+        }
+        if (unit) {
+          for (std::size_t i = 0; i < len; ++i) {
+            std::array<std::ptrdiff_t, N> o;
+            for (std::size_t op = 0; op < N; ++op)
+              o[op] = base[op] + std::ptrdiff_t(i);
+            apply(in_seq, o);
+          }
+        } else {
+          for (std::size_t i = 0; i < len; ++i) {
+            std::array<std::ptrdiff_t, N> o;
+            for (std::size_t op = 0; op < N; ++op)
+              o[op] = base[op] + std::ptrdiff_t(i) * step[op];
+            apply(in_seq, o);
+          }
+        }
+      } else {
+        auto e = c;
+        for (std::size_t i = begin; i < begin + len; ++i) {
+          e[inner] = static_cast<index_type>(i);
+          apply(in_seq, offsets(e));
+        }
+      }
+    };
+
+    // Box of outer modes: coalesced modes are pinned at 0 (the run covers them)
+    coord_type lo{}, hi = exts;
+    for (std::size_t d = 1; d < plan.run_modes; ++d)
+      hi[plan.order[R - 1 - d]] = 1;
+
+    std::size_t const threads = threads_for(out.size(), num_threads);
+
+    if (plan.blocked) {
+      // Same blocking as permute_copy; the budget counts the output twice
+      // (one output block plus one input block of similar width)
+      using value_type = typename Out::value_type;
+      constexpr std::size_t M = permute_micro_tile;
+      constexpr std::size_t B = permute_block_edge<value_type, value_type>();
+      auto const &tiles = plan.tiles;
+      std::size_t const ea = ext[tiles.a], eb = ext[tiles.b];
+      std::size_t const nba = (ea + B - 1) / B, nbb = (eb + B - 1) / B;
+      std::size_t outer_total = 1;
+      for (std::size_t d = 0; d < tiles.outer_count; ++d)
+        outer_total *= ext[tiles.outer[d]];
+
+      // One micro-tile at c (c[a], c[b] = tile origin), b innermost
+      auto const micro = [&](coord_type c, std::size_t na, std::size_t nb) {
+        if (plan.affine) {
+          auto const base = offsets(c);
+          for (std::size_t ia = 0; ia < na; ++ia)
+            for (std::size_t ib = 0; ib < nb; ++ib) {
+              offsets_type o;
+              for (std::size_t op = 0; op < N; ++op)
+                o[op] = base[op] +
+                        std::ptrdiff_t(ia) * plan.strides[op][tiles.a] +
+                        std::ptrdiff_t(ib) * plan.strides[op][tiles.b];
+              apply(in_seq, o);
+            }
+        } else {
+          auto const a0 = c[tiles.a], b0 = c[tiles.b];
+          for (std::size_t ia = 0; ia < na; ++ia)
+            for (std::size_t ib = 0; ib < nb; ++ib) {
+              c[tiles.a] = a0 + static_cast<index_type>(ia);
+              c[tiles.b] = b0 + static_cast<index_type>(ib);
+              apply(in_seq, offsets(c));
+            }
+        }
+      };
+
+      // Block id → (outer coordinate, block a, block b), block b fastest
+      auto const block = [&](std::size_t id) {
+        coord_type c{};
+        std::size_t const bb = id % nbb;
+        id /= nbb;
+        std::size_t const ba = id % nba;
+        id /= nba;
+        for (std::size_t d = 0; d < tiles.outer_count; ++d) {
+          std::size_t const e = ext[tiles.outer[d]];
+          c[tiles.outer[d]] = static_cast<index_type>(id % e);
+          id /= e;
+        }
+        std::size_t const a_end = std::min(ea, (ba + 1) * B);
+        std::size_t const b_end = std::min(eb, (bb + 1) * B);
+        for (std::size_t ta = ba * B; ta < a_end; ta += M)
+          for (std::size_t tb = bb * B; tb < b_end; tb += M) {
+            c[tiles.a] = static_cast<index_type>(ta);
+            c[tiles.b] = static_cast<index_type>(tb);
+            micro(c, std::min(M, a_end - ta), std::min(M, b_end - tb));
+          }
+      };
+
+      parallel_for_chunks(outer_total * nba * nbb, threads,
+                          [&](std::size_t b, std::size_t e) {
+                            for (std::size_t id = b; id < e; ++id)
+                              block(id);
+                          });
+      return;
+    }
+
+    if (plan.run_modes == R) {
+      // Fully coalesced: one run, split into contiguous chunks
+      parallel_for_chunks(plan.run_len, threads,
+                          [&](std::size_t b, std::size_t e) {
+                            run(lo, b, e - b);
+                          });
+      return;
+    }
+
+    // Split the widest outer mode; the loop nest keeps the stride-cost order
+    std::size_t split = plan.order[0];
+    for (std::size_t d = 1; d + plan.run_modes < R; ++d)
+      if (ext[plan.order[d]] > ext[split])
+        split = plan.order[d];
+
+    parallel_for_chunks(
+        ext[split], threads, [&](std::size_t b, std::size_t e) {
+          coord_type clo = lo, chi = hi, c{};
+          clo[split] = static_cast<index_type>(b);
+          chi[split] = static_cast<index_type>(e);
+          auto body = [&](coord_type const &cc) { run(cc, 0, plan.run_len); };
+          for_each_run(clo, chi, plan.order, c, body);
+        });
+  }
+}
+
+} // namespace detail
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// transform([num_threads,] out, f, ins...)
+// ═══════════════════════════════════════════════════════════════════════════════
+
+template <class TO, class EO, class LO, class AO, class F,
+          detail::any_mdspan... Ins>
+  requires std::invocable<F &, typename Ins::reference...>
+void transform(std::size_t num_threads, std::mdspan<TO, EO, LO, AO> out, F f,
+               Ins... ins) {
+  detail::transform_impl(num_threads, out, f, ins...);
+}
+
+template <class TO, class EO, class LO, class AO, class F,
+          detail::any_mdspan... Ins>
+  requires std::invocable<F &, typename Ins::reference...>
+void transform(std::mdspan<TO, EO, LO, AO> out, F f, Ins... ins) {
+  detail::transform_impl(default_num_threads(), out, f, ins...);
+}
+
+} // namespace mdspan_cute
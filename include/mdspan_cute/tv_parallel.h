@@ -0,0 +1,181 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// Copyright 2026 Weyl AI
+//
+// mdspan_cute/tv_parallel.h
+//
+// CPU parallel_for driven by cute thread layouts.
+//
+//   // cute's sm80 16x8 accumulator layout: (thread, value) → tile index
+//   using TV = cute::Layout<
+//       cute::Shape<cute::Shape<cute::_4, cute::_8>,
+//                   cute::Shape<cute::_2, cute::_2>>,
+//       cute::Stride<cute::Stride<cute::_32, cute::_1>,
+//                    cute::Stride<cute::_16, cute::_8>>>;
+//   auto const mn = cute::make_shape(cute::_16{}, cute::_8{});
+//   parallel_for(TV{}, mn, 8, md, [](auto const& coord, auto& x) { ... });
+//
+//   // One worker per thread of a thread layout, each on its local_partition
+//   parallel_for_partition(cute::make_layout(cute::make_shape(2, 4)), md, f);
+//
+// The layout that describes the work distribution is the layout that runs
+// it: trying another partitioning is an edit to a layout, not to loops.
+//
+// TV form. A rank-2 (thread, value) layout maps to colexicographic indices
+// of a tile of shape tile_shape, e.g. m + 16·n for the (16, 8) MMA tile
+// above. The tensor is split with zipped_divide(tensor, tile_shape), whose
+// tile mode composed with tv gives (thread, value) → tensor index, so each
+// tile sees the TV layout in its own (m, n) coordinates whatever the
+// tensor's extents. Every extent must be a multiple of the tile's. TV
+// thread t runs on worker t mod num_threads, visiting its values tile by
+// tile.
+//
+// Partition form. Thread t of a thread layout gets
+// local_partition(tensor, thr_layout, t): every element whose coordinate is
+// congruent to t's coordinate in thr_layout. Global coordinates come from
+// partitioning cute's identity tensor the same way, so hierarchical thread
+// and tensor shapes report the same coordinates md is indexed with.
+//
+// Workers are dedicated std::jthreads pinned to cores (Linux); the caller
+// only joins.
+
+#pragma once
+
+#include <mdspan_cute/index_space.h>
+#include <mdspan_cute/layout_cute.h>
+#include <mdspan_cute/parallel.h>
+#include <mdspan_cute/storage_order.h>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include <cute/layout.hpp>
+#include <cute/tensor.hpp>
+
+namespace mdspan_cute {
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// local_partition on a layout_cute mdspan
+// Same semantics as cute::local_partition; the result is again a layout_cute
+// mdspan over the thread's elements, starting at the thread's first element
+// and keeping md's accessor.
+// ═══════════════════════════════════════════════════════════════════════════════
+
+template <class T, class E, class CuteLayout, class A, cute_layout ThrLayout>
+[[nodiscard]] auto local_partition(
+    std::mdspan<T, E, layout_cute<CuteLayout>, A> const &md,
+    ThrLayout const &thr_layout, std::size_t thr_idx) {
+  auto tensor =
+      cute::make_tensor(md.data_handle(), md.mapping().cute_layout());
+  auto part = cute::local_partition(tensor, thr_layout, thr_idx);
+  auto const view = make_mdspan(part.data(), part.layout());
+  using view_type = std::remove_cvref_t<decltype(view)>;
+  return std::mdspan<T, typename view_type::extents_type,
+                     typename view_type::layout_type, A>(
+      view.data_handle(), view.mapping(), md.accessor());
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// parallel_for(tv_layout, tile_shape, num_threads, md, f): f(coord, element)
+// ═══════════════════════════════════════════════════════════════════════════════
+
+template <cute_layout TV, class TileShape, class T, class E, class L, class A,
+          class F>
+void parallel_for(TV const &tv, TileShape const &tile_shape,
+                  std::size_t num_threads, std::mdspan<T, E, L, A> md, F f,
+                  bool pin = true) {
+  constexpr std::size_t R = E::rank();
+  static_assert(cute::rank_v<TV> == 2,
+                "mdspan_cute::parallel_for: expected a (thread, value) "
+                "layout");
+  static_assert(cute::rank_v<TileShape> == R,
+                "mdspan_cute::parallel_for: rank(tile_shape) != rank(md)");
+  using coord_type = index_array<E>;
+
+  auto const exts = detail::extents_array(md.extents());
+  auto const shape = [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+    return cute::make_shape(static_cast<std::int64_t>(exts[Is])...);
+  }(std::make_index_sequence<R>{});
+  [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+    (assert(static_cast<std::size_t>(exts[Is]) %
+                detail::to_size_t(cute::get<Is>(tile_shape)) ==
+            0),
+     ...);
+  }(std::make_index_sequence<R>{});
+  assert(static_cast<std::size_t>(cute::cosize(tv)) <=
+             static_cast<std::size_t>(cute::size(tile_shape)) &&
+         "mdspan_cute::parallel_for: tv reaches past the tile");
+
+  // ((tile), (rest)) → colex index; tile mode ∘ tv is (thread, value) → index
+  auto const tiled = cute::zipped_divide(cute::make_layout(shape), tile_shape);
+  auto const tv_tile = cute::composition(cute::layout<0>(tiled), tv);
+  auto const rest = cute::layout<1>(tiled);
+
+  std::size_t const threads = cute::size<0>(tv);
+  std::size_t const values = cute::size<1>(tv);
+  std::size_t const tiles =
+      md.size() == 0 ? 0 : static_cast<std::size_t>(cute::size(rest));
+
+  std::size_t const workers =
+      std::max<std::size_t>(1, std::min(num_threads, threads));
+  run_workers(workers, pin, [&](std::size_t w) {
+    for (std::size_t t = w; t < threads; t += workers)
+      for (std::size_t i = 0; i < tiles; ++i)
+        for (std::size_t v = 0; v < values; ++v) {
+          auto const idx =
+              static_cast<std::size_t>(tv_tile(t, v) + rest(i));
+          coord_type const c = detail::unflatten_colex(idx, exts);
+          f(c, detail::element_at(md, c));
+        }
+  });
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// parallel_for_partition(thr_layout, md, f): one worker per thread of
+// thr_layout, each visiting its local_partition. f gets global coordinates.
+// ═══════════════════════════════════════════════════════════════════════════════
+
+template <cute_layout ThrLayout, class T, class E, class CuteLayout, class A,
+          class F>
+void parallel_for_partition(ThrLayout const &thr_layout,
+                            std::mdspan<T, E, layout_cute<CuteLayout>, A> md,
+                            F f, bool pin = true) {
+  constexpr std::size_t R = E::rank();
+  static_assert(cute::rank_v<ThrLayout> == cute::rank_v<CuteLayout>,
+                "mdspan_cute::parallel_for_partition: rank mismatch");
+  using coord_type = index_array<E>;
+  using index_type = typename E::index_type;
+
+  auto const shape = cute::shape(md.mapping().cute_layout());
+  [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+    (assert(detail::to_size_t(cute::size<Is>(shape)) %
+                detail::to_size_t(cute::size<Is>(thr_layout)) ==
+            0),
+     ...);
+  }(std::make_index_sequence<cute::rank_v<ThrLayout>>{});
+  auto const identity = cute::make_identity_tensor(shape);
+
+  run_workers(cute::size(thr_layout), pin, [&](std::size_t t) {
+    auto part = local_partition(md, thr_layout, t);
+    // Same partition of the identity tensor: local index → md coordinate
+    auto const coords = cute::local_partition(identity, thr_layout, t);
+    auto const exts = detail::extents_array(part.extents());
+    for_each_index(part.extents(), [&](auto const &local) {
+      auto const flat =
+          cute::flatten(coords(detail::flatten_colex(local, exts)));
+      coord_type c{};
+      [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+        ((c[Is] = static_cast<index_type>(
+              detail::to_size_t(cute::get<Is>(flat)))),
+         ...);
+      }(std::make_index_sequence<R>{});
+      f(c, detail::element_at(part, local));
+    });
+  });
+}
+
+} // namespace mdspan_cute
@@ -0,0 +1,369 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// Copyright 2026 Weyl AI
+//
+// mdspan_cute/vector_access.h
+//
+// Register-level vector loads and stores on static cute layouts.
+//
+//   auto t = mdspan_cute::make_mdspan(smem, swizzle::make_swizzled_layout<
+//       cute::Swizzle<2, 3, 3>>(cute::make_shape(cute::Int<16>{},
+//                                                cute::Int<64>{}),
+//                               cute::LayoutRight{}));
+//   auto v = mdspan_cute::load_vec<8>(t, std::array{i, j}); // j % 8 == 0
+//   mdspan_cute::store_vec<8>(t, std::array{i, j}, v * 2.0f);
+//
+// load_vec<N> reads the N elements that start at `coord` and run along the
+// layout's contiguous mode (the mode with static stride 1) as one aligned
+// vector. The layout is checked at compile time:
+//   - N is a power of two and divides the contiguous mode's extent;
+//   - every other stride (and the composed offset) is a multiple of N, so an
+//     N-aligned coordinate lands on an N-aligned offset;
+//   - for Swizzle<B, M, S>, N ≤ 2^M: an aligned run stays inside one 2^M
+//     block, whose low M bits the swizzle never touches and whose high bits
+//     it changes identically for every element.
+// A layout that fails any of these does not compile (vectorizable_v reports
+// the verdict without failing). At run time coord along the contiguous mode
+// must be a multiple of N and the data handle N · sizeof(T) aligned; both
+// are asserted.
+//
+// load_shuffled<N> / store_shuffled<N> cover layouts that permute elements
+// within a vector-sized block (small swizzles, interleaves, a column-major
+// 4×4 tile read in row-major order). The vector holds N consecutive elements
+// in logical (row-major) order starting at `coord`. At compile time every
+// aligned group of N logical elements is checked to occupy an aligned block
+// of N offsets under one shared permutation; the access is then one aligned
+// load or store plus a single register shuffle with that constant mask.
+//
+//   auto t = mdspan_cute::make_mdspan(p, col_major_4x4); // static layout
+//   auto rows = mdspan_cute::load_shuffled<16>(t, std::array{0, 0});
+//   // rows[4 * i + j] == t[i, j]
+//
+// vec<T, N> is the GCC/Clang vector extension type, so arithmetic on it maps
+// to the target's SIMD instructions.
+
+#pragma once
+
+#include <mdspan_cute/index_space.h>
+#include <mdspan_cute/layout_cute.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+#include <cute/layout.hpp>
+#include <cute/swizzle.hpp>
+
+namespace mdspan_cute {
+
+// ═══════════════════════════════════════════════════════════════════════════════
+namespace detail {
+
+template <class T, std::size_t N> struct vec_type {
+  typedef T type __attribute__((vector_size(N * sizeof(T))));
+};
+
+} // namespace detail
+
+// N lanes of T in one register
+template <class T, std::size_t N>
+using vec = typename detail::vec_type<T, N>::type;
+
+// ═══════════════════════════════════════════════════════════════════════════════
+namespace detail {
+
+// Verdict of the static analysis: whether N-element runs along `mode` are
+// physically adjacent
+struct vector_run {
+  bool ok = false;
+  std::size_t mode = 0;
+};
+
+template <std::size_t N, class L>
+consteval auto find_vector_run(L const &, std::int64_t) -> vector_run {
+  return {};
+}
+
+template <std::size_t N, class Shape, class Stride>
+consteval auto find_vector_run(cute::Layout<Shape, Stride> const &l,
+                               std::int64_t offset) -> vector_run {
+  auto const shape = flatten_shape(cute::shape(l));
+  auto const stride = flatten_shape(cute::stride(l));
+  constexpr std::size_t R = cute::tuple_size<
+      std::remove_cvref_t<decltype(shape)>>::value;
+  std::array<std::int64_t, R> e{}, s{};
+  [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+    ((e[Is] = static_cast<std::int64_t>(cute::get<Is>(shape)),
+      s[Is] = static_cast<std::int64_t>(cute::get<Is>(stride))),
+     ...);
+  }(std::make_index_sequence<R>{});
+
+  auto const n = static_cast<std::int64_t>(N);
+  if (!std::has_single_bit(N) || offset % n != 0)
+    return {};
+  for (std::size_t d = 0; d < R; ++d) {
+    if (s[d] != 1 || e[d] % n != 0)
+      continue;
+    bool aligned = true;
+    for (std::size_t k = 0; k < R; ++k)
+      aligned = aligned && (k == d || e[k] == 1 || s[k] % n == 0);
+    if (aligned)
+      return {true, d};
+  }
+  return {};
+}
+
+template <std::size_t N, int B, int M, int S, class Offset, class Inner>
+consteval auto find_vector_run(
+    cute::ComposedLayout<cute::Swizzle<B, M, S>, Offset, Inner> const &l,
+    std::int64_t offset) -> vector_run {
+  if (B > 0 && N > (std::size_t{1} << M))
+    return {};
+  return find_vector_run<N>(l.layout_b(),
+                            offset + static_cast<std::int64_t>(l.offset()));
+}
+
+template <class CuteLayout, std::size_t N>
+inline constexpr vector_run vector_run_v =
+    find_vector_run<N>(CuteLayout{}, 0);
+
+template <std::size_t N, class T, class E, class CuteLayout, class A,
+          class Index>
+[[nodiscard]] auto
+vector_address(std::mdspan<T, E, layout_cute<CuteLayout>, A> const &tile,
+               std::array<Index, E::rank()> const &coord) -> T * {
+  constexpr vector_run run = vector_run_v<CuteLayout, N>;
+  static_assert(run.ok,
+                "mdspan_cute::load_vec/store_vec: the layout does not keep "
+                "N-element runs physically adjacent");
+  assert(static_cast<std::size_t>(coord[run.mode]) % N == 0 &&
+         "mdspan_cute::load_vec/store_vec: coordinate not N-aligned");
+  T *const p =
+      tile.data_handle() + static_cast<std::size_t>(offset_at(tile.mapping(),
+                                                              coord));
+  assert(reinterpret_cast<std::uintptr_t>(p) % (N * sizeof(T)) == 0 &&
+         "mdspan_cute::load_vec/store_vec: misaligned data handle");
+  return p;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Shuffle plans: one permutation shared by every aligned group of N logical
+// (row-major) elements, each group filling an aligned block of N offsets
+// ─────────────────────────────────────────────────────────────────────────────
+
+template <std::size_t N> struct shuffle_plan {
+  bool ok = false;
+  std::array<int, N> perm{}; // lane l holds block element perm[l]
+};
+
+template <class CuteLayout, std::size_t N>
+consteval auto find_shuffle_plan() -> shuffle_plan<N> {
+  CuteLayout const l{};
+  auto const shape = flatten_shape(cute::shape(l));
+  constexpr std::size_t R = cute::tuple_size<
+      std::remove_cvref_t<decltype(shape)>>::value;
+  std::array<std::int64_t, R> e{};
+  [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+    ((e[Is] = static_cast<std::int64_t>(cute::get<Is>(shape))), ...);
+  }(std::make_index_sequence<R>{});
+  std::int64_t size = 1;
+  for (auto x : e)
+    size *= x;
+
+  auto const n = static_cast<std::int64_t>(N);
+  shuffle_plan<N> plan{};
+  if (!std::has_single_bit(N) || size % n != 0)
+    return plan;
+
+  // Offset of row-major linear index r (cute indexes column-major)
+  auto offset = [&](std::int64_t r) {
+    std::array<std::int64_t, R> c{};
+    for (std::size_t k = R; k-- > 0;) {
+      c[k] = r % e[k];
+      r /= e[k];
+    }
+    std::int64_t col = 0, scale = 1;
+    for (std::size_t k = 0; k < R; ++k) {
+      col += c[k] * scale;
+      scale *= e[k];
+    }
+    return static_cast<std::int64_t>(l(col));
+  };
+
+  for (std::int64_t g = 0; g < size; g += n) {
+    std::array<std::int64_t, N> o{};
+    std::int64_t lo = offset(g);
+    for (std::size_t k = 0; k < N; ++k) {
+      o[k] = offset(g + std::int64_t(k));
+      lo = std::min(lo, o[k]);
+    }
+    if (lo % n != 0)
+      return {};
+    std::array<int, N> perm{};
+    std::array<bool, N> seen{};
+    for (std::size_t k = 0; k < N; ++k) {
+      auto const d = o[k] - lo;
+      if (d >= n || seen[std::size_t(d)])
+        return {};
+      seen[std::size_t(d)] = true;
+      perm[k] = int(d);
+    }
+    if (g == 0)
+      plan.perm = perm;
+    else if (perm != plan.perm)
+      return {};
+  }
+  plan.ok = true;
+  return plan;
+}
+
+template <class CuteLayout, std::size_t N>
+inline constexpr shuffle_plan<N> shuffle_plan_v =
+    find_shuffle_plan<CuteLayout, N>();
+
+// Signed integer lanes for __builtin_shuffle masks
+template <std::size_t Bytes>
+using mask_lane_t = std::conditional_t<
+    Bytes == 1, std::int8_t,
+    std::conditional_t<Bytes == 2, std::int16_t,
+                       std::conditional_t<Bytes == 4, std::int32_t,
+                                          std::int64_t>>>;
+
+// out[l] = v[Perm[l]] as one shuffle with a constant mask
+template <auto Perm, class T, std::size_t N>
+[[nodiscard]] constexpr auto shuffle_lanes(vec<T, N> const &v)
+    -> vec<T, N> {
+  constexpr bool identity = [] {
+    for (std::size_t l = 0; l < N; ++l)
+      if (Perm[l] != int(l))
+        return false;
+    return true;
+  }();
+  if constexpr (identity) {
+    return v;
+  } else {
+    return [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+#if __has_builtin(__builtin_shufflevector)
+      return vec<T, N>(__builtin_shufflevector(v, v, Perm[Is]...));
+#else
+      using M = vec<mask_lane_t<sizeof(T)>, N>;
+      return __builtin_shuffle(v, M{Perm[Is]...});
+#endif
+    }(std::make_index_sequence<N>{});
+  }
+}
+
+template <std::size_t N>
+consteval auto inverse_permutation(std::array<int, N> const &p)
+    -> std::array<int, N> {
+  std::array<int, N> inv{};
+  for (std::size_t l = 0; l < N; ++l)
+    inv[std::size_t(p[l])] = int(l);
+  return inv;
+}
+
+// Start of the aligned block holding the group that begins at coord
+template <std::size_t N, class T, class E, class CuteLayout, class A,
+          class Index>
+[[nodiscard]] auto
+shuffle_block(std::mdspan<T, E, layout_cute<CuteLayout>, A> const &tile,
+              std::array<Index, E::rank()> const &coord) -> T * {
+  constexpr shuffle_plan<N> plan = shuffle_plan_v<CuteLayout, N>;
+  static_assert(plan.ok,
+                "mdspan_cute::load_shuffled/store_shuffled: the layout does "
+                "not map N-element groups to permuted aligned blocks");
+  std::size_t linear = 0;
+  for (std::size_t k = 0; k < E::rank(); ++k)
+    linear = linear * tile.extent(k) + static_cast<std::size_t>(coord[k]);
+  assert(linear % N == 0 &&
+         "mdspan_cute::load_shuffled/store_shuffled: coordinate not "
+         "N-aligned");
+  T *const p = tile.data_handle() +
+               static_cast<std::size_t>(offset_at(tile.mapping(), coord)) -
+               plan.perm[0];
+  assert(reinterpret_cast<std::uintptr_t>(p) % (N * sizeof(T)) == 0 &&
+         "mdspan_cute::load_shuffled/store_shuffled: misaligned data handle");
+  return p;
+}
+
+} // namespace detail
+
+// Whether load_vec<N> / store_vec<N> compile for a static cute layout
+template <class CuteLayout, std::size_t N>
+  requires cute_static_layout<CuteLayout>
+inline constexpr bool vectorizable_v =
+    detail::vector_run_v<CuteLayout, N>.ok;
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// load_vec<N>(tile, coord) / store_vec<N>(tile, coord, v)
+// ═══════════════════════════════════════════════════════════════════════════════
+
+template <std::size_t N, class T, class E, class CuteLayout, class A,
+          class Index>
+  requires cute_static_layout<CuteLayout>
+[[nodiscard]] auto
+load_vec(std::mdspan<T, E, layout_cute<CuteLayout>, A> const &tile,
+         std::array<Index, E::rank()> const &coord)
+    -> vec<std::remove_const_t<T>, N> {
+  using V = vec<std::remove_const_t<T>, N>;
+  auto const *p = detail::vector_address<N>(tile, coord);
+  V v;
+  std::memcpy(&v, __builtin_assume_aligned(p, sizeof(V)), sizeof(V));
+  return v;
+}
+
+template <std::size_t N, class T, class E, class CuteLayout, class A,
+          class Index>
+  requires cute_static_layout<CuteLayout> && (!std::is_const_v<T>)
+void store_vec(std::mdspan<T, E, layout_cute<CuteLayout>, A> const &tile,
+               std::array<Index, E::rank()> const &coord,
+               vec<T, N> const &v) {
+  auto *p = detail::vector_address<N>(tile, coord);
+  std::memcpy(__builtin_assume_aligned(p, sizeof(v)), &v, sizeof(v));
+}
+
+// ═══════════════════════════════════════════════════════════════════════════════
+// load_shuffled<N>(tile, coord) / store_shuffled<N>(tile, coord, v)
+// Lane l is the l-th element in row-major order from coord
+// ═══════════════════════════════════════════════════════════════════════════════
+
+// Whether load_shuffled<N> / store_shuffled<N> compile for a static layout
+template <class CuteLayout, std::size_t N>
+  requires cute_static_layout<CuteLayout>
+inline constexpr bool shufflable_v =
+    detail::shuffle_plan_v<CuteLayout, N>.ok;
+
+template <std::size_t N, class T, class E, class CuteLayout, class A,
+          class Index>
+  requires cute_static_layout<CuteLayout>
+[[nodiscard]] auto
+load_shuffled(std::mdspan<T, E, layout_cute<CuteLayout>, A> const &tile,
+              std::array<Index, E::rank()> const &coord)
+    -> vec<std::remove_const_t<T>, N> {
+  using V = vec<std::remove_const_t<T>, N>;
+  constexpr auto perm = detail::shuffle_plan_v<CuteLayout, N>.perm;
+  auto const *p = detail::shuffle_block<N>(tile, coord);
+  V raw;
+  std::memcpy(&raw, __builtin_assume_aligned(p, sizeof(V)), sizeof(V));
+  return detail::shuffle_lanes<perm, std::remove_const_t<T>, N>(raw);
+}
+
+template <std::size_t N, class T, class E, class CuteLayout, class A,
+          class Index>
+  requires cute_static_layout<CuteLayout> && (!std::is_const_v<T>)
+void store_shuffled(std::mdspan<T, E, layout_cute<CuteLayout>, A> const &tile,
+                    std::array<Index, E::rank()> const &coord,
+                    vec<T, N> const &v) {
+  constexpr auto inv =
+      detail::inverse_permutation(detail::shuffle_plan_v<CuteLayout, N>.perm);
+  auto *p = detail::shuffle_block<N>(tile, coord);
+  auto const raw = detail::shuffle_lanes<inv, T, N>(v);
+  std::memcpy(__builtin_assume_aligned(p, sizeof(raw)), &raw, sizeof(raw));
+}
+
+} // namespace mdspan_cute
@@ -0,0 +1,110 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#include <catch2/catch_all.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+#include <cute/layout.hpp>
+#include <cute/swizzle.hpp>
+
+#include <mdspan_cute/arena.h>
+
+using namespace mdspan_cute;
+
+namespace {
+
+auto address(void const *p) -> std::uintptr_t {
+  return reinterpret_cast<std::uintptr_t>(p);
+}
+
+} // namespace
+
+// ──────────────────────────────────────────────────────────────────────────────
+// Alignment
+// ──────────────────────────────────────────────────────────────────────────────
+
+TEST_CASE("layout_alignment follows vector width and swizzle period",
+          "[arena]") {
+  auto plain = cute::make_layout(cute::make_shape(8, 8));
+  auto sw = swizzle::make_swizzled_layout<swizzle::sw128>(
+      cute::make_shape(64, 64), cute::make_stride(64, 1));
+  auto sw32 = swizzle::make_swizzled_layout<swizzle::sw32>(
+      cute::make_shape(16, 16), cute::make_stride(16, 1));
+
+  STATIC_REQUIRE(layout_alignment<float>(decltype(plain){}) == 64);
+  // Swizzle<3,3,3>: 512 elements · 4 bytes = 2 KiB period
+  REQUIRE(layout_alignment<float>(sw) == 2048);
+  // Swizzle<1,3,3>: 128 elements · 2 bytes = 256 bytes
+  REQUIRE(layout_alignment<std::uint16_t>(sw32) == 256);
+  // Swizzle<2,2,-2> shifts the other way but spans the same 2^(2+2+2) = 64
+  // elements · 4 bytes = 256 bytes
+  auto neg = swizzle::make_swizzled_layout<cute::Swizzle<2, 2, -2>>(
+      cute::make_shape(16, 16), cute::make_stride(16, 1));
+  REQUIRE(layout_alignment<float>(neg) == 256);
+  // Capped at one page
+  REQUIRE(layout_alignment<double>(sw) == arena_page_size);
+}
+
+// ──────────────────────────────────────────────────────────────────────────────
+// allocate_for
+// ──────────────────────────────────────────────────────────────────────────────
+
+TEST_CASE("allocate_for: cosize elements at the layout's alignment",
+          "[arena]") {
+  bump_arena arena;
+  auto sw = swizzle::make_swizzled_layout<swizzle::sw128>(
+      cute::make_shape(64, 64), cute::make_stride(64, 1));
+
+  auto small = allocate_for<char>(cute::make_layout(cute::make_shape(3)),
+                                  arena);
+  auto tile = allocate_for<float>(sw, arena);
+  REQUIRE(address(small.data_handle()) % 64 == 0);
+  REQUIRE(address(tile.data_handle()) % 2048 == 0);
+  REQUIRE(tile.mapping().required_span_size() == 64 * 64);
+
+  for (std::size_t i = 0; i < 64; ++i)
+    for (std::size_t j = 0; j < 64; ++j)
+      tile[i, j] = float(i * 64 + j);
+  REQUIRE(tile[63, 63] == 4095.0f);
+}
+
+TEST_CASE("bump_arena: reset and scopes reuse the same memory", "[arena]") {
+  bump_arena arena(4096);
+  auto l = cute::make_layout(cute::make_shape(16, 16));
+
+  auto a = allocate_for<int>(l, arena);
+  {
+    arena_scope scope(arena);
+    auto b = allocate_for<int>(l, arena);
+    REQUIRE(b.data_handle() != a.data_handle());
+  }
+  auto c = allocate_for<int>(l, arena);
+  REQUIRE(arena.capacity() == 4096);
+
+  arena.reset();
+  REQUIRE(arena.bytes_in_use() == 0);
+  auto d = allocate_for<int>(l, arena);
+  REQUIRE(d.data_handle() == a.data_handle());
+  static_cast<void>(c);
+}
+
+TEST_CASE("bump_arena: oversized requests get their own chunk", "[arena]") {
+  bump_arena arena(4096);
+  auto big = allocate_for<float>(
+      cute::make_layout(cute::make_shape(1024, 1024)), arena); // 4 MiB
+  big[1023, 1023] = 1.0f;
+  big[0, 0] = 2.0f;
+  REQUIRE(big[1023, 1023] == 1.0f);
+  REQUIRE(arena.capacity() >= 4u << 20);
+
+  arena.release();
+  REQUIRE(arena.capacity() == 0);
+}
+
+TEST_CASE("thread_arena is per thread", "[arena]") {
+  bump_arena *main_arena = &thread_arena();
+  bump_arena *other = nullptr;
+  std::jthread([&] { other = &thread_arena(); }).join();
+  REQUIRE(other != main_arena);
+}
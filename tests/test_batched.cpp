@@ -0,0 +1,161 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#include <catch2/catch_all.hpp>
+#include <rapidcheck/catch.h>
+
+#include <cstddef>
+#include <vector>
+
+#include <cute/layout.hpp>
+#include <cute/swizzle.hpp>
+
+#include <mdspan_cute/batched.h>
+
+using namespace mdspan_cute;
+
+namespace {
+
+auto tile4x4() {
+  return cute::make_layout(cute::make_shape(cute::Int<4>{}, cute::Int<4>{}),
+                           cute::LayoutRight{});
+}
+
+} // namespace
+
+// ──────────────────────────────────────────────────────────────────────────────
+// Layouts
+// ──────────────────────────────────────────────────────────────────────────────
+
+TEST_CASE("batched layout: tile-major keeps tiles contiguous", "[batched]") {
+  std::vector<int> buf(16 * 5);
+  auto x = make_batched_mdspan(buf.data(), tile4x4(), 5);
+  REQUIRE(x.rank() == 3);
+  REQUIRE(x.extent(2) == 5);
+  REQUIRE(x.mapping().required_span_size() == 80);
+  REQUIRE(x.mapping().is_unique());
+  REQUIRE(&x[1, 2, 3] == buf.data() + 3 * 16 + 1 * 4 + 2);
+  REQUIRE(x.stride(2) == 16);
+}
+
+TEST_CASE("batched layout: interleaved gives the batch unit stride",
+          "[batched]") {
+  std::vector<int> buf(16 * 5);
+  auto y = make_batched_mdspan<batch_order::interleaved>(buf.data(),
+                                                         tile4x4(), 5);
+  REQUIRE(y.stride(2) == 1);
+  REQUIRE(y.stride(1) == 5);
+  REQUIRE(y.stride(0) == 20);
+  REQUIRE(y.mapping().required_span_size() == 80);
+  REQUIRE(y.mapping().is_unique());
+  REQUIRE(&y[1, 2, 3] == buf.data() + (1 * 4 + 2) * 5 + 3);
+}
+
+TEST_CASE("batched layout: nested tile modes are flattened", "[batched]") {
+  auto tile = cute::make_layout(cute::make_shape(cute::make_shape(2, 3), 4));
+  std::vector<int> buf(24 * 2);
+  auto x = make_batched_mdspan(buf.data(), tile, 2);
+  REQUIRE(x.rank() == 4);
+  REQUIRE(&x[1, 2, 3, 1] == buf.data() + 24 + 1 + 2 * 2 + 3 * 6);
+}
+
+TEST_CASE("batched layout: swizzled tiles repeat the same swizzle",
+          "[batched]") {
+  auto tile = make_swizzled_layout<cute::Swizzle<1, 2, 2>>(
+      cute::make_shape(cute::Int<4>{}, cute::Int<8>{}), cute::LayoutRight{});
+  std::vector<int> buf(32 * 3);
+  auto x = make_batched_mdspan(buf.data(), tile, 3);
+  for (int b = 0; b < 3; ++b)
+    for (int i = 0; i < 4; ++i)
+      for (int j = 0; j < 8; ++j)
+        REQUIRE(&x[i, j, b] ==
+                buf.data() + b * 32 + int(tile(cute::make_coord(i, j))));
+}
+
+// ──────────────────────────────────────────────────────────────────────────────
+// batch_transform
+// ──────────────────────────────────────────────────────────────────────────────
+
+TEST_CASE("batch_transform mixes tile-major and interleaved operands",
+          "[batched]") {
+  std::size_t const n = 300;
+  std::vector<float> a(16 * n), b(16 * n), out(16 * n, 0.0f);
+  auto xa = make_batched_mdspan(a.data(), tile4x4(), int(n));
+  auto xb = make_batched_mdspan<batch_order::interleaved>(b.data(), tile4x4(),
+                                                          int(n));
+  auto xo = make_batched_mdspan<batch_order::interleaved>(out.data(),
+                                                          tile4x4(), int(n));
+  for (std::size_t t = 0; t < n; ++t)
+    for (std::size_t i = 0; i < 4; ++i)
+      for (std::size_t j = 0; j < 4; ++j) {
+        xa[i, j, t] = float(t);
+        xb[i, j, t] = float(i * 4 + j);
+      }
+
+  batch_transform(4, xo, [](float p, float q) { return p * 100 + q; }, xa,
+                  xb);
+  for (std::size_t t = 0; t < n; ++t)
+    for (std::size_t i = 0; i < 4; ++i)
+      for (std::size_t j = 0; j < 4; ++j)
+        REQUIRE(xo[i, j, t] == float(t * 100 + i * 4 + j));
+}
+
+TEST_CASE("batch_transform resolves non-affine batch modes per element",
+          "[batched][swizzle]") {
+  // Swizzle<2,0,2> XORs the batch bits into the tile bits, so the batch step
+  // differs per tile: 5 at tile (0, 0) but 3 at tile (1, 0)
+  auto const swz = swizzle::make_swizzled_layout<cute::Swizzle<2, 0, 2>>(
+      cute::make_shape(2, 2, 4), cute::make_stride(1, 2, 4));
+  auto const plain = cute::make_layout(cute::make_shape(2, 2, 4));
+  std::vector<int> a(16), out(16, -1);
+  auto xa = make_mdspan(a.data(), swz);
+  auto xo = make_mdspan(out.data(), plain);
+  for (std::size_t t = 0; t < 4; ++t)
+    for (std::size_t i = 0; i < 2; ++i)
+      for (std::size_t j = 0; j < 2; ++j)
+        xa[i, j, t] = int(t * 10 + i * 2 + j);
+
+  batch_transform(2, xo, [](int v) { return v + 1; }, xa);
+  for (std::size_t t = 0; t < 4; ++t)
+    for (std::size_t i = 0; i < 2; ++i)
+      for (std::size_t j = 0; j < 2; ++j)
+        REQUIRE(xo[i, j, t] == int(t * 10 + i * 2 + j + 1));
+}
+
+// ──────────────────────────────────────────────────────────────────────────────
+// Property: batch_transform matches an elementwise loop
+// ──────────────────────────────────────────────────────────────────────────────
+
+TEST_CASE("batch_transform matches a scalar loop", "[property][batched]") {
+  rc::prop("batch_transform matches a scalar loop",
+    [](std::size_t m_, std::size_t k_, std::size_t n_, std::size_t threads_,
+       bool interleave_in, bool interleave_out) {
+      int const m = 1 + int(m_ % 5), k = 1 + int(k_ % 5);
+      int const n = int(n_ % 200);
+      std::size_t const threads = 1 + threads_ % 4;
+      auto tile = cute::make_layout(cute::make_shape(m, k));
+      std::size_t const total = std::size_t(m * k * n);
+
+      std::vector<int> src(total), dst(total, -1);
+      for (std::size_t i = 0; i < total; ++i)
+        src[i] = int(i);
+
+      auto check = [&](auto in, auto out) {
+        batch_transform(threads, out, [](int v) { return 3 * v + 1; }, in);
+        for (int b = 0; b < n; ++b)
+          for (int i = 0; i < m; ++i)
+            for (int j = 0; j < k; ++j)
+              RC_ASSERT(out[i, j, b] == 3 * in[i, j, b] + 1);
+      };
+      auto tm = [&](auto *p) { return make_batched_mdspan(p, tile, n); };
+      auto il = [&](auto *p) {
+        return make_batched_mdspan<batch_order::interleaved>(p, tile, n);
+      };
+      if (interleave_in && interleave_out)
+        check(il(src.data()), il(dst.data()));
+      else if (interleave_in)
+        check(il(src.data()), tm(dst.data()));
+      else if (interleave_out)
+        check(tm(src.data()), il(dst.data()));
+      else
+        check(tm(src.data()), tm(dst.data()));
+    });
+}
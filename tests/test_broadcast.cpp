@@ -0,0 +1,175 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#include <catch2/catch_all.hpp>
+#include <rapidcheck/catch.h>
+
+#include <array>
+#include <cstddef>
+#include <set>
+#include <vector>
+
+#include <cute/layout.hpp>
+#include <cute/swizzle.hpp>
+
+#include <mdspan_cute/broadcast.h>
+
+using namespace mdspan_cute;
+
+// ──────────────────────────────────────────────────────────────────────────────
+// Uniqueness detection
+// ──────────────────────────────────────────────────────────────────────────────
+
+TEST_CASE("layout_cute uniqueness: static layouts decided at compile time",
+          "[broadcast][unique]") {
+  using col = cute::Layout<cute::Shape<cute::_4, cute::_8>>;
+  using bcast = cute::Layout<cute::Shape<cute::_4, cute::_8>,
+                             cute::Stride<cute::_0, cute::_1>>;
+  using swz = decltype(swizzle::make_swizzled_layout<swizzle::sw32>(
+      cute::Shape<cute::_8, cute::_8>{}, cute::Stride<cute::_8, cute::_1>{}));
+
+  STATIC_REQUIRE(cute_mdspan<float, col>::is_always_unique());
+  STATIC_REQUIRE(cute_mdspan<float, swz>::is_always_unique());
+  STATIC_REQUIRE(!cute_mdspan<float, bcast>::is_always_unique());
+
+  std::vector<float> buf(64);
+  REQUIRE(make_mdspan(buf.data(), col{}).is_unique());
+  REQUIRE(make_mdspan(buf.data(), swz{}).is_unique());
+  REQUIRE(!make_mdspan(buf.data(), bcast{}).is_unique());
+}
+
+TEST_CASE("layout_cute uniqueness: dynamic layouts checked at runtime",
+          "[broadcast][unique]") {
+  std::vector<int> buf(64);
+  auto dyn = make_mdspan(buf.data(), cute::make_layout(cute::make_shape(4, 5)));
+  STATIC_REQUIRE(!decltype(dyn)::is_always_unique());
+  REQUIRE(dyn.is_unique());
+
+  // Overlapping rows (pigeonhole: 9 indices, 7 offsets)
+  auto overlap = cute::make_layout(cute::make_shape(3, 3),
+                                   cute::make_stride(1, 2));
+  REQUIRE(!make_mdspan(buf.data(), overlap).is_unique());
+
+  // Interleaved but injective: the strides do not nest, so the verdict is
+  // unknown and is_unique() answers conservatively
+  auto interleaved = cute::make_layout(cute::make_shape(3, 3),
+                                       cute::make_stride(2, 3));
+  REQUIRE(detail::stride_uniqueness(interleaved) ==
+          detail::uniqueness::unknown);
+  REQUIRE(!make_mdspan(buf.data(), interleaved).is_unique());
+
+  // Collides at offset 4 although the span exceeds the size
+  auto collide = cute::make_layout(cute::make_shape(3, 3),
+                                   cute::make_stride(2, 4));
+  REQUIRE(!make_mdspan(buf.data(), collide).is_unique());
+}
+
+// ──────────────────────────────────────────────────────────────────────────────
+// Broadcast views
+// ──────────────────────────────────────────────────────────────────────────────
+
+TEST_CASE("make_broadcast_mdspan: bias broadcast across rows",
+          "[broadcast]") {
+  std::vector<float> bias{1, 2, 3, 4, 5};
+  auto b = make_broadcast_mdspan<0>(bias.data(), cute::make_shape(7, 5));
+  REQUIRE(b.extent(0) == 7);
+  REQUIRE(b.extent(1) == 5);
+  REQUIRE(!b.is_unique());
+  REQUIRE(b.mapping().required_span_size() == 5);
+  for (std::size_t i = 0; i < 7; ++i)
+    for (std::size_t j = 0; j < 5; ++j)
+      REQUIRE(b[i, j] == bias[j]);
+}
+
+TEST_CASE("make_broadcast_mdspan: static middle mode broadcast",
+          "[broadcast]") {
+  std::vector<int> src(2 * 3);
+  for (std::size_t i = 0; i < src.size(); ++i)
+    src[i] = int(i);
+  auto b = make_broadcast_mdspan<1>(
+      src.data(), cute::Shape<cute::_2, cute::_4, cute::_3>{});
+  STATIC_REQUIRE(!decltype(b)::is_always_unique());
+  for (std::size_t i = 0; i < 2; ++i)
+    for (std::size_t k = 0; k < 4; ++k)
+      for (std::size_t j = 0; j < 3; ++j)
+        REQUIRE(b[i, k, j] == int(i + 2 * j));
+}
+
+// ──────────────────────────────────────────────────────────────────────────────
+// Sliding windows
+// ──────────────────────────────────────────────────────────────────────────────
+
+TEST_CASE("make_sliding_window_mdspan: 1-D overlapping windows",
+          "[broadcast][window]") {
+  std::vector<int> x(10);
+  for (std::size_t i = 0; i < 10; ++i)
+    x[i] = int(i);
+  auto base = cute::make_layout(cute::make_shape(10));
+
+  auto w = make_sliding_window_mdspan(x.data(), base,
+                                      std::array<std::size_t, 1>{3});
+  REQUIRE(w.extent(0) == 8);
+  REQUIRE(w.extent(1) == 3);
+  REQUIRE(!w.is_unique());
+  for (std::size_t p = 0; p < 8; ++p)
+    for (std::size_t k = 0; k < 3; ++k)
+      REQUIRE(w[p, k] == x[p + k]);
+
+  // Step equal to the window tiles without overlap
+  auto tiles = make_sliding_window_mdspan(
+      x.data(), base, std::array<std::size_t, 1>{3},
+      std::array<std::size_t, 1>{3});
+  REQUIRE(tiles.extent(0) == 3);
+  REQUIRE(tiles.is_unique());
+}
+
+TEST_CASE("make_sliding_window_mdspan: im2col over a row-major image",
+          "[broadcast][window]") {
+  std::size_t const h = 6, wd = 7;
+  std::vector<float> img(h * wd);
+  for (std::size_t i = 0; i < img.size(); ++i)
+    img[i] = float(i);
+  auto base = cute::make_layout(cute::make_shape(int(h), int(wd)),
+                                cute::make_stride(int(wd), 1));
+
+  auto win = make_sliding_window_mdspan(img.data(), base,
+                                        std::array<std::size_t, 2>{3, 3},
+                                        std::array<std::size_t, 2>{1, 2},
+                                        std::array<std::size_t, 2>{1, 2});
+  // Rows: (6 − 3)/1 + 1 = 4; cols: (7 − 5)/2 + 1 = 2
+  REQUIRE(win.extent(0) == 4);
+  REQUIRE(win.extent(1) == 2);
+  REQUIRE(win.extent(2) == 3);
+  REQUIRE(win.extent(3) == 3);
+  for (std::size_t oh = 0; oh < 4; ++oh)
+    for (std::size_t ow = 0; ow < 2; ++ow)
+      for (std::size_t kh = 0; kh < 3; ++kh)
+        for (std::size_t kw = 0; kw < 3; ++kw)
+          REQUIRE(win[oh, ow, kh, kw] ==
+                  img[(oh + kh) * wd + (ow * 2 + kw * 2)]);
+}
+
+// ──────────────────────────────────────────────────────────────────────────────
+// Property: is_unique is sound, and exact whenever the strides decide it
+// ──────────────────────────────────────────────────────────────────────────────
+
+TEST_CASE("is_unique matches a brute-force check", "[property][unique]") {
+  rc::prop("is_unique matches a brute-force check",
+    [](std::size_t a_, std::size_t b_, std::size_t c_, std::size_t sa_,
+       std::size_t sb_, std::size_t sc_) {
+      int const a = 1 + int(a_ % 5), b = 1 + int(b_ % 5), c = 1 + int(c_ % 5);
+      int const sa = int(sa_ % 9), sb = int(sb_ % 9), sc = int(sc_ % 9);
+      auto l = cute::make_layout(cute::make_shape(a, b, c),
+                                 cute::make_stride(sa, sb, sc));
+      std::vector<int> buf(std::size_t(cute::cosize(l)));
+      auto md = make_mdspan(buf.data(), l);
+
+      std::set<int> seen;
+      for (int i = 0; i < a; ++i)
+        for (int j = 0; j < b; ++j)
+          for (int k = 0; k < c; ++k)
+            seen.insert(i * sa + j * sb + k * sc);
+      bool const unique = seen.size() == std::size_t(a * b * c);
+      RC_ASSERT(!md.is_unique() || unique);
+      if (detail::stride_uniqueness(l) != detail::uniqueness::unknown)
+        RC_ASSERT(md.is_unique() == unique);
+    });
+}
@@ -0,0 +1,123 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#include <catch2/catch_all.hpp>
+#include <rapidcheck/catch.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include <cute/layout.hpp>
+
+#include <mdspan_cute/compressed.h>
+
+using namespace mdspan_cute;
+
+// ──────────────────────────────────────────────────────────────────────────────
+// Codec stages
+// ──────────────────────────────────────────────────────────────────────────────
+
+TEST_CASE("lz codec round-trips and shrinks repetitive data", "[compressed]") {
+  std::vector<std::uint8_t> in(10000);
+  for (std::size_t i = 0; i < in.size(); ++i)
+    in[i] = std::uint8_t((i % 17) * 3);
+  std::vector<std::uint8_t> packed;
+  detail::lz_compress(in.data(), in.size(), packed);
+  REQUIRE(packed.size() < in.size() / 20);
+
+  std::vector<std::uint8_t> back(in.size());
+  REQUIRE(detail::lz_decompress(packed.data(), packed.size(), back.data(),
+                                back.size()));
+  REQUIRE(back == in);
+
+  // Truncated input is rejected, not overrun
+  REQUIRE(!detail::lz_decompress(packed.data(), packed.size() - 1,
+                                 back.data(), back.size()));
+}
+
+TEST_CASE("byte shuffle groups bytes by plane", "[compressed]") {
+  std::uint32_t const in[3] = {0x11223344u, 0x55667788u, 0x99aabbccu};
+  std::uint8_t out[12];
+  detail::byte_shuffle(reinterpret_cast<std::uint8_t const *>(in), out, 3, 4);
+  std::uint8_t back[12];
+  detail::byte_unshuffle(out, back, 3, 4);
+  REQUIRE(std::memcmp(back, in, 12) == 0);
+  // Plane 0 holds the first byte of each element in memory order
+  auto const *bytes = reinterpret_cast<std::uint8_t const *>(in);
+  REQUIRE(out[0] == bytes[0]);
+  REQUIRE(out[1] == bytes[4]);
+  REQUIRE(out[2] == bytes[8]);
+}
+
+// ──────────────────────────────────────────────────────────────────────────────
+// compressed_tensor
+// ──────────────────────────────────────────────────────────────────────────────
+
+TEST_CASE("compressed tensor decodes single tiles on demand", "[compressed]") {
+  // 100 × 70 smooth field, 32 × 32 tiles: clipped edge tiles on both modes
+  std::vector<float> x(100 * 70);
+  std::mdspan<float, std::dextents<std::size_t, 2>> src(x.data(), 100, 70);
+  for (std::size_t i = 0; i < 100; ++i)
+    for (std::size_t j = 0; j < 70; ++j)
+      src[i, j] = float(i / 10) * 0.5f;
+
+  auto ct = compress_tiles(
+      src, cute::make_shape(cute::Int<32>{}, cute::Int<32>{}));
+  REQUIRE(ct.tile_count() == 4 * 3);
+  REQUIRE(ct.stats().raw_bytes == x.size() * sizeof(float));
+  REQUIRE(ct.stats().ratio() > 4.0);
+
+  std::vector<float> scratch(ct.max_tile_size());
+  auto tile = ct.decompress_tile({3, 2}, scratch.data());
+  REQUIRE(tile.extent(0) == 4); // rows 96..99
+  REQUIRE(tile.extent(1) == 6); // cols 64..69
+  for (std::size_t r = 0; r < 4; ++r)
+    for (std::size_t c = 0; c < 6; ++c)
+      REQUIRE(tile[r, c] == src[96 + r, 64 + c]);
+
+  REQUIRE(ct.decode_throughput() > 0.0);
+}
+
+TEST_CASE("incompressible tiles are stored raw", "[compressed]") {
+  std::vector<std::uint32_t> x(64);
+  std::uint32_t s = 12345;
+  for (auto &v : x)
+    v = s = s * 1664525u + 1013904223u;
+  std::mdspan<std::uint32_t, std::dextents<std::size_t, 1>> src(x.data(), 64);
+  auto ct = compress_tiles(src, cute::make_shape(16));
+  REQUIRE(ct.stats().raw_tiles == 4);
+  REQUIRE(ct.stats().compressed_bytes == x.size() * 4);
+  REQUIRE(ct.codec({1}) == tile_codec::raw);
+}
+
+// ──────────────────────────────────────────────────────────────────────────────
+// Property: compress → decompress is the identity for every codec and layout
+// ──────────────────────────────────────────────────────────────────────────────
+
+TEST_CASE("compressed tensor round-trips", "[property][compressed]") {
+  rc::prop("compressed tensor round-trips",
+    [](std::size_t m_, std::size_t n_, std::size_t tm_, std::size_t tn_,
+       std::size_t codec_, std::vector<std::uint8_t> const &noise) {
+      int const m = 1 + int(m_ % 50), n = 1 + int(n_ % 50);
+      int const tm = 1 + int(tm_ % 16), tn = 1 + int(tn_ % 16);
+      auto const codec = tile_codec(codec_ % 3);
+
+      // Column-major source with repetitive values and some noise
+      std::vector<std::int16_t> x(std::size_t(m * n));
+      for (std::size_t i = 0; i < x.size(); ++i)
+        x[i] = std::int16_t(i / 5 + (noise.empty()
+                                         ? 0
+                                         : noise[i % noise.size()] % 4));
+      auto src = make_mdspan(x.data(),
+                             cute::make_layout(cute::make_shape(m, n)));
+      auto ct = compress_tiles(src, cute::make_shape(tm, tn), codec, 2);
+
+      std::vector<std::int16_t> y(x.size(), -1);
+      std::mdspan<std::int16_t, std::dextents<std::size_t, 2>> dst(
+          y.data(), std::size_t(m), std::size_t(n));
+      ct.decompress(dst, 2);
+      for (int i = 0; i < m; ++i)
+        for (int j = 0; j < n; ++j)
+          RC_ASSERT(dst[i, j] == src[i, j]);
+    });
+}
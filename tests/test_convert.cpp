@@ -0,0 +1,130 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#include <catch2/catch_all.hpp>
+#include <rapidcheck/catch.h>
+
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include <cute/layout.hpp>
+#include <cute/swizzle.hpp>
+
+#include <mdspan_cute/convert.h>
+
+using namespace mdspan_cute;
+
+// ──────────────────────────────────────────────────────────────────────────────
+// Element conversions
+// ──────────────────────────────────────────────────────────────────────────────
+
+TEST_CASE("storage types are trivial", "[convert]") {
+  // Required by arena-backed buffers (allocate_for, tile_cache)
+  STATIC_REQUIRE(std::is_trivial_v<bf16_t>);
+  STATIC_REQUIRE(std::is_trivial_v<fp16_t>);
+  STATIC_REQUIRE(std::is_trivial_v<fp8_e4m3_t>);
+  STATIC_REQUIRE(sizeof(bf16_t) == 2);
+  STATIC_REQUIRE(sizeof(fp8_e4m3_t) == 1);
+}
+
+TEST_CASE("bf16 rounds to nearest even", "[convert]") {
+  STATIC_REQUIRE(bf16_t(1.0f).bits == 0x3f80);
+  // 1 + 2^-8 is halfway between 1 and 1 + 2^-7: ties to even
+  STATIC_REQUIRE(bf16_t(1.0f + 0x1.0p-8f).bits == 0x3f80);
+  STATIC_REQUIRE(bf16_t(1.0f + 3 * 0x1.0p-8f).bits == 0x3f82);
+  STATIC_REQUIRE(bf16_t(-2.0f).bits == 0xc000);
+  REQUIRE(bf16_t(std::numeric_limits<float>::infinity()).bits == 0x7f80);
+  REQUIRE(std::isnan(float(bf16_t(std::numeric_limits<float>::quiet_NaN()))));
+}
+
+TEST_CASE("fp16 covers normals, subnormals and overflow", "[convert]") {
+  STATIC_REQUIRE(fp16_t(1.0f).bits == 0x3c00);
+  STATIC_REQUIRE(fp16_t(65504.0f).bits == 0x7bff);
+  STATIC_REQUIRE(fp16_t(65520.0f).bits == 0x7c00); // rounds up to inf
+  STATIC_REQUIRE(fp16_t(0x1.0p-24f).bits == 0x0001);
+  STATIC_REQUIRE(fp16_t(-0.0f).bits == 0x8000);
+
+  // Every non-NaN half round-trips exactly, at run time too
+  for (std::uint32_t h = 0; h < 0x10000; ++h) {
+    if ((h & 0x7c00) == 0x7c00 && (h & 0x03ff) != 0)
+      continue;
+    fp16_t x;
+    x.bits = std::uint16_t(h);
+    REQUIRE(fp16_t(float(x)).bits == h);
+    REQUIRE(detail::fp16_to_float_portable(std::uint16_t(h)) == float(x));
+  }
+}
+
+TEST_CASE("fp8 e4m3 saturates and round-trips", "[convert]") {
+  STATIC_REQUIRE(fp8_e4m3_t(1.0f).bits == 0x38);
+  STATIC_REQUIRE(fp8_e4m3_t(448.0f).bits == 0x7e);
+  STATIC_REQUIRE(fp8_e4m3_t(1000.0f).bits == 0x7e);
+  STATIC_REQUIRE(fp8_e4m3_t(-1000.0f).bits == 0xfe);
+  STATIC_REQUIRE(fp8_e4m3_t(0x1.0p-9f).bits == 0x01);
+  STATIC_REQUIRE(fp8_e4m3_t(0x1.0p-6f).bits == 0x08);
+  // 1.0625 is halfway between 1 and 1.125: ties to even
+  STATIC_REQUIRE(fp8_e4m3_t(1.0625f).bits == 0x38);
+  REQUIRE(fp8_e4m3_t(std::numeric_limits<float>::quiet_NaN()).bits == 0x7f);
+
+  for (std::uint32_t b = 0; b < 0x100; ++b) {
+    if ((b & 0x7f) == 0x7f)
+      continue;
+    fp8_e4m3_t x;
+    x.bits = std::uint8_t(b);
+    REQUIRE(fp8_e4m3_t(float(x)).bits == b);
+  }
+}
+
+// ──────────────────────────────────────────────────────────────────────────────
+// convert_copy
+// ──────────────────────────────────────────────────────────────────────────────
+
+TEST_CASE("convert_copy: row-major fp32 into a swizzled bf16 tile",
+          "[convert]") {
+  std::vector<float> x(32 * 64);
+  for (std::size_t i = 0; i < x.size(); ++i)
+    x[i] = float(i) * 0.37f - 100.0f;
+  std::mdspan<float const, std::dextents<int, 2>> src(x.data(), 32, 64);
+
+  std::vector<bf16_t> staging(32 * 64);
+  auto dst = make_mdspan(
+      staging.data(),
+      swizzle::make_swizzled_layout<swizzle::sw128>(
+          cute::make_shape(cute::Int<32>{}, cute::Int<64>{}),
+          cute::LayoutRight{}));
+  convert_copy(src, dst, 3);
+  for (int i = 0; i < 32; ++i)
+    for (int j = 0; j < 64; ++j)
+      REQUIRE(dst[i, j] == bf16_t(src[i, j]));
+}
+
+// ──────────────────────────────────────────────────────────────────────────────
+// Property: convert_copy equals per-element conversion across layouts
+// ──────────────────────────────────────────────────────────────────────────────
+
+TEST_CASE("convert_copy matches elementwise conversion",
+          "[property][convert]") {
+  rc::prop("convert_copy matches elementwise conversion",
+    [](std::size_t m_, std::size_t n_, std::size_t threads_,
+       std::vector<float> const &vals) {
+      int const m = 1 + int(m_ % 40), n = 1 + int(n_ % 40);
+      std::size_t const threads = 1 + threads_ % 4;
+      std::size_t const size = std::size_t(m * n);
+      std::vector<float> x(size);
+      for (std::size_t i = 0; i < size; ++i)
+        x[i] = vals.empty() ? float(i) : vals[i % vals.size()];
+
+      // Column-major fp32 → row-major fp16
+      auto src = make_mdspan(x.data(),
+                             cute::make_layout(cute::make_shape(m, n)));
+      std::vector<fp16_t> y(size);
+      std::mdspan<fp16_t, std::dextents<int, 2>> dst(y.data(), m, n);
+      convert_copy(src, dst, threads);
+      for (int i = 0; i < m; ++i)
+        for (int j = 0; j < n; ++j)
+          RC_ASSERT(dst[i, j] == fp16_t(src[i, j]));
+    });
+}
@@ -0,0 +1,132 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#include <catch2/catch_all.hpp>
+#include <rapidcheck/catch.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+#include <cute/layout.hpp>
+
+#include <mdspan_cute/curve_layouts.h>
+
+using namespace mdspan_cute;
+
+namespace {
+
+// True when every offset in [0, size) is hit exactly once
+template <class MD> bool is_bijection(MD const &md) {
+  std::vector<int> hits(md.size(), 0);
+  auto const &m = md.mapping();
+  bool ok = true;
+  auto visit = [&](std::size_t off) {
+    ok = ok && off < hits.size() && hits[off]++ == 0;
+  };
+  if constexpr (MD::rank() == 2) {
+    for (std::size_t i = 0; i < md.extent(0); ++i)
+      for (std::size_t j = 0; j < md.extent(1); ++j)
+        visit(std::size_t(m(i, j)));
+  } else {
+    for (std::size_t i = 0; i < md.extent(0); ++i)
+      for (std::size_t j = 0; j < md.extent(1); ++j)
+        for (std::size_t k = 0; k < md.extent(2); ++k)
+          visit(std::size_t(m(i, j, k)));
+  }
+  return ok;
+}
+
+} // namespace
+
+// ──────────────────────────────────────────────────────────────────────────────
+// Bit deposit
+// ──────────────────────────────────────────────────────────────────────────────
+
+TEST_CASE("deposit_bits scatters low bits into the mask", "[curve]") {
+  STATIC_REQUIRE(detail::deposit_bits_portable(0b101, 0b11010) == 0b10010);
+  STATIC_REQUIRE(detail::deposit_bits_portable(0xFF, 0) == 0);
+  for (std::uint64_t x : {0ull, 1ull, 0x1234ull, 0xFFFFFFFFull})
+    for (std::uint64_t mask : {0x5555555555555555ull, 0xF0F0ull, 0x8001ull})
+      REQUIRE(detail::deposit_bits(x, mask) ==
+              detail::deposit_bits_portable(x, mask));
+}
+
+// ──────────────────────────────────────────────────────────────────────────────
+// Morton
+// ──────────────────────────────────────────────────────────────────────────────
+
+TEST_CASE("morton layout: Z-order offsets on a square grid", "[curve]") {
+  auto z = make_morton_layout(cute::make_shape(4, 4));
+  std::vector<float> buf(std::size_t(cute::cosize(z)));
+  auto md = make_mdspan(buf.data(), z);
+  auto const &m = md.mapping();
+  REQUIRE(m(0, 0) == 0);
+  REQUIRE(m(1, 0) == 1);
+  REQUIRE(m(0, 1) == 2);
+  REQUIRE(m(1, 1) == 3);
+  REQUIRE(m(2, 0) == 4);
+  REQUIRE(m(0, 2) == 8);
+  REQUIRE(m(3, 3) == 15);
+  REQUIRE(is_bijection(md));
+  REQUIRE(md.is_unique());
+}
+
+TEST_CASE("morton layout: unequal bits append the extra high bits",
+          "[curve]") {
+  auto z = make_morton_layout(cute::make_shape(8, 2));
+  std::vector<int> buf(std::size_t(cute::cosize(z)));
+  auto md = make_mdspan(buf.data(), z);
+  // Levels: (i0, j0), (i1), (i2)
+  REQUIRE(md.mapping()(1, 1) == 3);
+  REQUIRE(md.mapping()(2, 0) == 4);
+  REQUIRE(md.mapping()(4, 1) == 10);
+  REQUIRE(is_bijection(md));
+
+  auto z3 = make_morton_layout(cute::make_shape(4, 2, 8));
+  std::vector<int> buf3(std::size_t(cute::cosize(z3)));
+  REQUIRE(is_bijection(make_mdspan(buf3.data(), z3)));
+}
+
+// ──────────────────────────────────────────────────────────────────────────────
+// Hilbert
+// ──────────────────────────────────────────────────────────────────────────────
+
+TEST_CASE("hilbert layout: consecutive offsets are grid neighbours",
+          "[curve]") {
+  auto h2 = make_hilbert_layout(2);
+  REQUIRE(h2(cute::make_coord(0, 0)) == 0);
+  REQUIRE(h2(cute::make_coord(0, 1)) == 1);
+  REQUIRE(h2(cute::make_coord(1, 1)) == 2);
+  REQUIRE(h2(cute::make_coord(1, 0)) == 3);
+
+  int const n = 16;
+  auto h = make_hilbert_layout(n);
+  std::vector<double> buf(std::size_t(cute::cosize(h)));
+  auto md = make_mdspan(buf.data(), h);
+  REQUIRE(is_bijection(md));
+
+  std::vector<std::array<int, 2>> cell(std::size_t(n * n));
+  for (int i = 0; i < n; ++i)
+    for (int j = 0; j < n; ++j)
+      cell[std::size_t(md.mapping()(i, j))] = {i, j};
+  for (std::size_t d = 1; d < cell.size(); ++d)
+    REQUIRE(std::abs(cell[d][0] - cell[d - 1][0]) +
+                std::abs(cell[d][1] - cell[d - 1][1]) ==
+            1);
+}
+
+// ──────────────────────────────────────────────────────────────────────────────
+// Property: Morton layouts are bijections for any power-of-two shape
+// ──────────────────────────────────────────────────────────────────────────────
+
+TEST_CASE("morton layout is a bijection", "[property][curve]") {
+  rc::prop("morton layout is a bijection",
+    [](std::size_t a_, std::size_t b_, std::size_t c_) {
+      int const a = 1 << (a_ % 4), b = 1 << (b_ % 4), c = 1 << (c_ % 4);
+      auto z = make_morton_layout(cute::make_shape(a, b, c));
+      RC_ASSERT(std::size_t(cute::cosize(z)) == std::size_t(a * b * c));
+      std::vector<int> buf(std::size_t(a * b * c));
+      RC_ASSERT(is_bijection(make_mdspan(buf.data(), z)));
+    });
+}
@@ -0,0 +1,154 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#include <catch2/catch_all.hpp>
+#include <rapidcheck/catch.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <cute/layout.hpp>
+#include <cute/swizzle.hpp>
+
+#include <mdspan_cute/gather.h>
+
+using namespace mdspan_cute;
+
+namespace {
+
+// (16, 32) embedding table with a swizzle inside each 8 × 32 block
+auto swizzled_table(float *p) {
+  return make_mdspan(p, swizzle::make_swizzled_layout<cute::Swizzle<2, 2, 3>>(
+                            cute::make_shape(cute::Int<16>{}, cute::Int<32>{}),
+                            cute::LayoutRight{}));
+}
+
+} // namespace
+
+// ──────────────────────────────────────────────────────────────────────────────
+// take
+// ──────────────────────────────────────────────────────────────────────────────
+
+TEST_CASE("take gathers rows of a swizzled table", "[gather]") {
+  std::vector<float> buf(16 * 32);
+  auto table = swizzled_table(buf.data());
+  for (std::size_t r = 0; r < 16; ++r)
+    for (std::size_t d = 0; d < 32; ++d)
+      table[r, d] = float(r * 100 + d);
+
+  std::vector<int> const ids{5, 0, 5, 15, 3};
+  for (auto order : {index_order::as_given, index_order::by_cache_line}) {
+    std::vector<float> out(ids.size() * 32, -1.0f);
+    std::mdspan<float, std::dextents<std::size_t, 2>> o(out.data(),
+                                                        ids.size(), 32);
+    take(table, ids, o, 0, order, 2);
+    for (std::size_t k = 0; k < ids.size(); ++k)
+      for (std::size_t d = 0; d < 32; ++d)
+        REQUIRE(o[k, d] == float(ids[k] * 100 + int(d)));
+  }
+}
+
+TEST_CASE("take along an inner mode", "[gather]") {
+  std::vector<int> a(3 * 6);
+  for (std::size_t i = 0; i < a.size(); ++i)
+    a[i] = int(i);
+  std::mdspan<int, std::dextents<std::size_t, 2>> src(a.data(), 3, 6);
+  std::vector<std::uint32_t> const cols{4, 1};
+  std::vector<int> b(3 * 2);
+  std::mdspan<int, std::dextents<std::size_t, 2>> dst(b.data(), 3, 2);
+  take(src, cols, dst, 1);
+  REQUIRE(b == std::vector<int>{4, 1, 10, 7, 16, 13});
+}
+
+// ──────────────────────────────────────────────────────────────────────────────
+// put
+// ──────────────────────────────────────────────────────────────────────────────
+
+TEST_CASE("put scatters rows; the last repeat wins", "[gather]") {
+  std::vector<float> buf(16 * 32, 0.0f);
+  auto table = swizzled_table(buf.data());
+  std::vector<float> rows(3 * 32);
+  for (std::size_t i = 0; i < rows.size(); ++i)
+    rows[i] = float(i / 32 + 1);
+  std::mdspan<float, std::dextents<std::size_t, 2>> src(rows.data(), 3, 32);
+
+  std::vector<long> const ids{9, 2, 9};
+  put(table, ids, src, 0, index_order::by_cache_line, 4);
+  for (std::size_t d = 0; d < 32; ++d) {
+    REQUIRE(table[9, d] == 3.0f);
+    REQUIRE(table[2, d] == 2.0f);
+    REQUIRE(table[0, d] == 0.0f);
+  }
+}
+
+TEST_CASE("put with heavily repeated indices across threads", "[gather]") {
+  // Token routing: 4096 rows onto 8 experts, many writers per row
+  std::vector<float> buf(16 * 32, 0.0f);
+  auto table = swizzled_table(buf.data());
+  std::vector<float> rows(4096 * 32);
+  std::vector<int> ids(4096);
+  for (std::size_t k = 0; k < ids.size(); ++k) {
+    ids[k] = int((k * 7) % 8);
+    for (std::size_t d = 0; d < 32; ++d)
+      rows[k * 32 + d] = float(k);
+  }
+  std::mdspan<float, std::dextents<std::size_t, 2>> src(rows.data(), 4096,
+                                                        32);
+  for (auto order : {index_order::as_given, index_order::by_cache_line}) {
+    put(table, ids, src, 0, order, 8);
+    for (int e = 0; e < 8; ++e) {
+      // Last k with (7k) mod 8 == e
+      std::size_t last = 0;
+      for (std::size_t k = 0; k < ids.size(); ++k)
+        if (ids[k] == e)
+          last = k;
+      for (std::size_t d = 0; d < 32; ++d)
+        REQUIRE(table[std::size_t(e), d] == float(last));
+    }
+  }
+}
+
+// ──────────────────────────────────────────────────────────────────────────────
+// Property: both orders match a reference gather/scatter
+// ──────────────────────────────────────────────────────────────────────────────
+
+TEST_CASE("take and put match a reference loop", "[property][gather]") {
+  rc::prop("take and put match a reference loop",
+    [](std::vector<std::uint8_t> const &raw, bool sorted,
+       std::size_t threads_) {
+      std::size_t const threads = 1 + threads_ % 4;
+      auto const order =
+          sorted ? index_order::by_cache_line : index_order::as_given;
+      std::vector<int> ids;
+      for (auto r : raw)
+        ids.push_back(int(r % 16));
+
+      std::vector<float> buf(16 * 32);
+      auto table = swizzled_table(buf.data());
+      for (std::size_t r = 0; r < 16; ++r)
+        for (std::size_t d = 0; d < 32; ++d)
+          table[r, d] = float(r * 100 + d);
+
+      std::vector<float> out(ids.size() * 32);
+      std::mdspan<float, std::dextents<std::size_t, 2>> o(out.data(),
+                                                          ids.size(), 32);
+      take(table, ids, o, 0, order, threads);
+      for (std::size_t k = 0; k < ids.size(); ++k)
+        for (std::size_t d = 0; d < 32; ++d)
+          RC_ASSERT(o[k, d] == table[std::size_t(ids[k]), d]);
+
+      // Scatter rows tagged with their position back; ids may repeat and
+      // the last occurrence must win for any thread count
+      for (std::size_t k = 0; k < ids.size(); ++k)
+        for (std::size_t d = 0; d < 32; ++d)
+          o[k, d] = -float(k * 100 + d);
+      put(table, ids, o, 0, order, threads);
+      std::vector<std::size_t> last(16, ids.size());
+      for (std::size_t k = 0; k < ids.size(); ++k)
+        last[std::size_t(ids[k])] = k;
+      for (std::size_t r = 0; r < 16; ++r)
+        for (std::size_t d = 0; d < 32; ++d)
+          RC_ASSERT(table[r, d] == (last[r] == ids.size()
+                                        ? float(r * 100 + d)
+                                        : -float(last[r] * 100 + d)));
+    });
+}
@@ -0,0 +1,145 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#include <catch2/catch_all.hpp>
+#include <rapidcheck/catch.h>
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#include <cute/layout.hpp>
+#include <cute/swizzle.hpp>
+
+#include <mdspan_cute/mdarray.h>
+
+using namespace mdspan_cute;
+
+using static_8x8 = cute::Layout<cute::Shape<cute::_8, cute::_8>,
+                                cute::Stride<cute::_8, cute::_1>>;
+using padded_4x6 = cute::Layout<cute::Shape<cute::_4, cute::_6>,
+                                cute::Stride<cute::_1, cute::_5>>;
+
+// ──────────────────────────────────────────────────────────────────────────────
+// Static layouts: inline storage
+// ──────────────────────────────────────────────────────────────────────────────
+
+TEST_CASE("cute_mdarray: static layout stores cosize elements inline",
+          "[mdarray]") {
+  using A = cute_mdarray<float, static_8x8>;
+  STATIC_REQUIRE(A::is_inline);
+  STATIC_REQUIRE(std::is_same_v<A::container_type, std::array<float, 64>>);
+  STATIC_REQUIRE(sizeof(A) == 64 * sizeof(float));
+  STATIC_REQUIRE(A::rank() == 2);
+
+  A acc;
+  REQUIRE(acc.container_size() == 64);
+  for (std::size_t i = 0; i < 8; ++i)
+    for (std::size_t j = 0; j < 8; ++j) {
+      REQUIRE(acc[i, j] == 0.0f);
+      acc[i, j] = float(i * 8 + j);
+    }
+  for (std::size_t k = 0; k < 64; ++k)
+    REQUIRE(acc.data()[k] == float(k));
+}
+
+TEST_CASE("cute_mdarray: padded static layout owns the padding",
+          "[mdarray]") {
+  cute_mdarray a(padded_4x6{}, 7);
+  STATIC_REQUIRE(std::is_same_v<decltype(a), cute_mdarray<int, padded_4x6>>);
+  REQUIRE(a.size() == 24);
+  REQUIRE(a.container_size() == std::size_t(cute::cosize(padded_4x6{})));
+  for (auto v : a.container())
+    REQUIRE(v == 7);
+  a[3, 5] = 42;
+  REQUIRE(a.data()[3 + 5 * 5] == 42);
+}
+
+TEST_CASE("cute_mdarray: constexpr construction and access", "[mdarray]") {
+  constexpr auto sum = [] {
+    cute_mdarray<int, static_8x8> a;
+    for (int i = 0; i < 8; ++i)
+      a[i, i] = i;
+    int s = 0;
+    for (int i = 0; i < 8; ++i)
+      s += a[i, i];
+    return s;
+  }();
+  STATIC_REQUIRE(sum == 28);
+}
+
+// ──────────────────────────────────────────────────────────────────────────────
+// Dynamic layouts: vector storage
+// ──────────────────────────────────────────────────────────────────────────────
+
+TEST_CASE("cute_mdarray: dynamic swizzled layout uses a vector",
+          "[mdarray][swizzle]") {
+  auto swz = swizzle::make_swizzled_layout<swizzle::sw64>(
+      cute::make_shape(16, 32), cute::make_stride(32, 1));
+  using A = cute_mdarray<float, decltype(swz)>;
+  STATIC_REQUIRE(!A::is_inline);
+  STATIC_REQUIRE(std::is_same_v<A::container_type, std::vector<float>>);
+
+  A tile(swz);
+  REQUIRE(tile.extent(0) == 16);
+  REQUIRE(tile.extent(1) == 32);
+  REQUIRE(tile.container_size() == std::size_t(cute::cosize(swz)));
+
+  for (std::size_t i = 0; i < 16; ++i)
+    for (std::size_t j = 0; j < 32; ++j)
+      tile[i, j] = float(i * 32 + j);
+  for (std::size_t i = 0; i < 16; ++i)
+    for (std::size_t j = 0; j < 32; ++j)
+      REQUIRE(tile.data()[swz(i, j)] == float(i * 32 + j));
+}
+
+// ──────────────────────────────────────────────────────────────────────────────
+// Views and copies
+// ──────────────────────────────────────────────────────────────────────────────
+
+TEST_CASE("cute_mdarray converts to a cute_mdspan view", "[mdarray]") {
+  cute_mdarray<double, static_8x8> a;
+  cute_mdspan<double, static_8x8> view = a;
+  view[2, 5] = 3.5;
+  REQUIRE(a[2, 5] == 3.5);
+  REQUIRE(view.data_handle() == a.data());
+
+  auto const &ca = a;
+  auto cview = ca.to_mdspan();
+  STATIC_REQUIRE(
+      std::is_same_v<decltype(cview)::element_type, double const>);
+  REQUIRE(cview[2, 5] == 3.5);
+}
+
+TEST_CASE("cute_mdarray copies are deep", "[mdarray]") {
+  auto l = cute::make_layout(cute::make_shape(3, 5));
+  cute_mdarray<int, decltype(l)> a(l, 1);
+  auto b = a;
+  b[1, 4] = 9;
+  REQUIRE(a[1, 4] == 1);
+  REQUIRE(b[1, 4] == 9);
+  REQUIRE(a.data() != b.data());
+}
+
+// ──────────────────────────────────────────────────────────────────────────────
+// Property: element access agrees with the view for any dynamic layout
+// ──────────────────────────────────────────────────────────────────────────────
+
+TEST_CASE("cute_mdarray access matches its mdspan view",
+          "[property][mdarray]") {
+  rc::prop("cute_mdarray access matches its mdspan view",
+    [](std::size_t m_, std::size_t n_, std::size_t pad_) {
+      int const m = 1 + int(m_ % 17), n = 1 + int(n_ % 17);
+      int const ld = m + int(pad_ % 4);
+      auto l = cute::make_layout(cute::make_shape(m, n),
+                                 cute::make_stride(1, ld));
+      cute_mdarray<int, decltype(l)> a(l);
+      RC_ASSERT(a.container_size() == std::size_t(cute::cosize(l)));
+      auto view = a.to_mdspan();
+      for (int i = 0; i < m; ++i)
+        for (int j = 0; j < n; ++j)
+          view[i, j] = i * n + j;
+      for (int i = 0; i < m; ++i)
+        for (int j = 0; j < n; ++j)
+          RC_ASSERT(a[i, j] == i * n + j);
+    });
+}
@@ -0,0 +1,91 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#include <catch2/catch_all.hpp>
+#include <rapidcheck/catch.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <cute/layout.hpp>
+
+#include <mdspan_cute/packing.h>
+
+using namespace mdspan_cute;
+
+// ──────────────────────────────────────────────────────────────────────────────
+// Layout presets
+// ──────────────────────────────────────────────────────────────────────────────
+
+TEST_CASE("vnni layout: K pairs are adjacent per column", "[packing]") {
+  STATIC_REQUIRE(packing::vnni_factor<std::int8_t> == 4);
+  STATIC_REQUIRE(packing::vnni_factor<std::uint16_t> == 2);
+  STATIC_REQUIRE(packing::vnni_factor<float> == 1);
+
+  auto l = packing::make_vnni_layout<2>(6, 5);
+  REQUIRE(int(cute::cosize(l)) == 30);
+  // (k, n) → (k / 2) · 10 + n · 2 + k % 2
+  for (int k = 0; k < 6; ++k)
+    for (int n = 0; n < 5; ++n)
+      REQUIRE(int(l(cute::make_coord(cute::make_coord(k % 2, k / 2), n))) ==
+              (k / 2) * 10 + n * 2 + k % 2);
+}
+
+TEST_CASE("vnni layout: static extents stay static", "[packing]") {
+  auto l = packing::make_vnni_layout<4>(cute::Int<64>{}, cute::Int<16>{});
+  STATIC_REQUIRE(cute_static_layout<decltype(l)>);
+  STATIC_REQUIRE(decltype(cute::cosize(l))::value == 64 * 16);
+}
+
+// ──────────────────────────────────────────────────────────────────────────────
+// pack_vnni
+// ──────────────────────────────────────────────────────────────────────────────
+
+TEST_CASE("pack_vnni zero-pads a partial last group", "[packing]") {
+  std::vector<std::int8_t> b(5 * 3);
+  for (std::size_t i = 0; i < b.size(); ++i)
+    b[i] = std::int8_t(i + 1);
+  std::mdspan<std::int8_t const, std::dextents<std::size_t, 2>> src(b.data(),
+                                                                    5, 3);
+  std::vector<std::int8_t> packed(
+      std::size_t(cute::cosize(packing::make_vnni_layout<4>(5, 3))), -1);
+  REQUIRE(packed.size() == 24);
+
+  auto p = pack_vnni(src, packed.data());
+  REQUIRE(p.rank() == 3);
+  REQUIRE(p.extent(0) == 4);
+  REQUIRE(p.extent(1) == 2);
+  // Column 1 of group 0 holds b[0..4, 1]; group 1 holds b[4, 1] then zeros
+  REQUIRE(packed[4] == b[1]);
+  REQUIRE(packed[7] == b[3 * 3 + 1]);
+  REQUIRE(packed[12 + 4] == b[4 * 3 + 1]);
+  REQUIRE(packed[12 + 5] == 0);
+  REQUIRE(packed[12 + 7] == 0);
+}
+
+// ──────────────────────────────────────────────────────────────────────────────
+// Property: packed offsets match the hand-written VNNI index math
+// ──────────────────────────────────────────────────────────────────────────────
+
+TEST_CASE("pack_vnni matches reference index math", "[property][packing]") {
+  rc::prop("pack_vnni matches reference index math",
+    [](std::size_t k_, std::size_t n_, std::size_t threads_) {
+      std::size_t const k = 1 + k_ % 37, n = 1 + n_ % 29;
+      std::size_t const threads = 1 + threads_ % 4;
+      std::vector<std::uint16_t> b(k * n);
+      for (std::size_t i = 0; i < b.size(); ++i)
+        b[i] = std::uint16_t(i + 1);
+      std::mdspan<std::uint16_t, std::dextents<std::size_t, 2>> src(b.data(),
+                                                                    k, n);
+
+      std::size_t const groups = (k + 1) / 2;
+      std::vector<std::uint16_t> packed(groups * n * 2, 0xffff);
+      pack_vnni<2>(src, packed.data(), threads);
+      for (std::size_t g = 0; g < groups; ++g)
+        for (std::size_t j = 0; j < n; ++j)
+          for (std::size_t r = 0; r < 2; ++r) {
+            std::size_t const row = g * 2 + r;
+            RC_ASSERT(packed[g * n * 2 + j * 2 + r] ==
+                      (row < k ? b[row * n + j] : 0));
+          }
+    });
+}
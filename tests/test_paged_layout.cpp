@@ -0,0 +1,227 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#include <catch2/catch_all.hpp>
+#include <rapidcheck/catch.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#include <cute/layout.hpp>
+
+#include <mdspan_cute/paged_layout.h>
+
+using namespace mdspan_cute;
+
+namespace {
+
+float encode(std::size_t s, std::size_t p, std::size_t h, std::size_t d) {
+  return float(s * 100000 + p * 100 + h * 10 + d);
+}
+
+// Non-pointer data handle; every read is doubled
+struct doubling_accessor {
+  struct data_handle_type {
+    float const *p = nullptr;
+  };
+  using element_type = float const;
+  using reference = float;
+  using offset_policy = doubling_accessor;
+
+  constexpr auto access(data_handle_type h, std::size_t i) const -> float {
+    return 2.0f * h.p[i];
+  }
+  constexpr auto offset(data_handle_type h, std::size_t i) const
+      -> data_handle_type {
+    return {h.p + i};
+  }
+};
+
+} // namespace
+
+// ──────────────────────────────────────────────────────────────────────────────
+// Element access through the block table
+// ──────────────────────────────────────────────────────────────────────────────
+
+TEST_CASE("paged layout: kv[seq, pos, head, dim] resolves through the table",
+          "[paged]") {
+  // 2 sequences × 3 blocks of 4 tokens, token shape (2 heads, 3 dims)
+  std::vector<std::int32_t> table{5, 2, -1, 0, 3, 4};
+  std::int64_t const page_elems = 4 * 2 * 3;
+  std::vector<float> pool(6 * page_elems, -1.0f);
+
+  auto layout = make_paged_layout(table.data(), 2, 3, 4,
+                                  cute::make_shape(2, 3));
+  auto kv = make_mdspan(pool.data(), layout);
+  REQUIRE(kv.rank() == 4);
+  REQUIRE(kv.extent(0) == 2);
+  REQUIRE(kv.extent(1) == 12);
+  REQUIRE(kv.extent(2) == 2);
+  REQUIRE(kv.extent(3) == 3);
+
+  for (std::size_t s = 0; s < 2; ++s)
+    for (std::size_t p = 0; p < 12; ++p) {
+      if (table[s * 3 + p / 4] < 0)
+        continue;
+      for (std::size_t h = 0; h < 2; ++h)
+        for (std::size_t d = 0; d < 3; ++d)
+          kv[s, p, h, d] = encode(s, p, h, d);
+    }
+
+  // Physical placement: page base + (slot, head, dim) row-major
+  for (std::size_t s = 0; s < 2; ++s)
+    for (std::size_t p = 0; p < 12; ++p) {
+      auto const page = table[s * 3 + p / 4];
+      if (page < 0)
+        continue;
+      for (std::size_t h = 0; h < 2; ++h)
+        for (std::size_t d = 0; d < 3; ++d)
+          REQUIRE(pool[std::size_t(page) * page_elems + (p % 4) * 6 + h * 3 +
+                       d] == encode(s, p, h, d));
+    }
+  // Page 1 is not referenced by the table and stays untouched
+  for (std::int64_t i = 0; i < page_elems; ++i)
+    REQUIRE(pool[std::size_t(page_elems + i)] == -1.0f);
+}
+
+TEST_CASE("paged layout: power-of-two pages use the shift path", "[paged]") {
+  std::vector<std::int32_t> table{1, 0};
+  std::vector<int> pool(2 * 8 * 4);
+  auto layout = make_paged_layout(table.data(), 1, 2, 8,
+                                  cute::make_shape(cute::Int<4>{}));
+  REQUIRE(layout.layout_a().page_shift == 5);
+  auto kv = make_mdspan(pool.data(), layout);
+  kv[0, 3, 1] = 7;  // block 0 → page 1
+  kv[0, 12, 2] = 9; // block 1 → page 0, slot 4
+  REQUIRE(pool[32 + 3 * 4 + 1] == 7);
+  REQUIRE(pool[4 * 4 + 2] == 9);
+}
+
+TEST_CASE("paged layout: span and uniqueness come from the table",
+          "[paged]") {
+  std::int64_t const page_elems = 4 * 2 * 3;
+  // Pool pages past num_seqs · max_blocks: the span follows the table
+  std::vector<std::int32_t> sparse{9, -1, 2, 0, 7, -1};
+  auto a = make_paged_layout(sparse.data(), 2, 3, 4, cute::make_shape(2, 3));
+  std::vector<float> pool(10 * page_elems);
+  auto kv = make_mdspan(pool.data(), a);
+  REQUIRE(kv.mapping().required_span_size() == std::size_t(10 * page_elems));
+  REQUIRE(kv.mapping()(0, 3, 1, 2) <
+          kv.mapping().required_span_size()); // block 0 → page 9
+  // Unallocated entries are ignored, not dereferenced
+  REQUIRE(kv.is_unique());
+  REQUIRE(!kv.is_exhaustive());
+
+  // Two blocks sharing page 2 alias
+  std::vector<std::int32_t> shared{2, -1, 2, 0, 1, -1};
+  auto b = make_mdspan(pool.data(),
+                       make_paged_layout(shared.data(), 2, 3, 4,
+                                         cute::make_shape(2, 3)));
+  REQUIRE(!b.is_unique());
+  REQUIRE(b.mapping().required_span_size() == std::size_t(3 * page_elems));
+}
+
+// ──────────────────────────────────────────────────────────────────────────────
+// for_each_page: one table lookup per page, dense page views
+// ──────────────────────────────────────────────────────────────────────────────
+
+TEST_CASE("for_each_page visits allocated pages as dense views", "[paged]") {
+  std::vector<std::int32_t> table{3, -1, 1, 0, 2, -1};
+  std::vector<float> pool(4 * 4 * 2 * 3);
+  auto kv = make_mdspan(pool.data(),
+                        make_paged_layout(table.data(), 2, 3, 4,
+                                          cute::make_shape(2, 3)));
+  for (std::size_t s = 0; s < 2; ++s)
+    for (std::size_t p = 0; p < 12; ++p)
+      if (table[s * 3 + p / 4] >= 0)
+        for (std::size_t h = 0; h < 2; ++h)
+          for (std::size_t d = 0; d < 3; ++d)
+            kv[s, p, h, d] = encode(s, p, h, d);
+
+  std::size_t pages = 0;
+  bool ok = true;
+  for_each_page(kv, [&](std::int64_t s, std::int64_t b, auto page) {
+    ++pages;
+    ok = ok && page.rank() == 3 && page.extent(0) == 4 &&
+         page.extent(1) == 2 && page.extent(2) == 3;
+    for (std::size_t slot = 0; slot < 4; ++slot)
+      for (std::size_t h = 0; h < 2; ++h)
+        for (std::size_t d = 0; d < 3; ++d)
+          ok = ok && page[slot, h, d] ==
+                         encode(std::size_t(s), std::size_t(b) * 4 + slot, h,
+                                d);
+  });
+  REQUIRE(pages == 4);
+  REQUIRE(ok);
+}
+
+TEST_CASE("for_each_page keeps kv's accessor and data handle", "[paged]") {
+  std::vector<std::int32_t> table{1, 0};
+  std::vector<float> pool(2 * 4 * 3);
+  std::iota(pool.begin(), pool.end(), 0.0f);
+  auto const layout = make_paged_layout(table.data(), 1, 2, 4,
+                                        cute::make_shape(3));
+  auto const plain = make_mdspan(pool.data(), layout);
+  std::mdspan<float const, decltype(plain)::extents_type,
+              decltype(plain)::layout_type, doubling_accessor> const
+      kv({pool.data()}, plain.mapping(), doubling_accessor{});
+
+  std::size_t pages = 0;
+  for_each_page(kv, [&](std::int64_t, std::int64_t b, auto page) {
+    ++pages;
+    // Block b lives in physical page table[b]
+    for (std::size_t slot = 0; slot < 4; ++slot)
+      for (std::size_t d = 0; d < 3; ++d)
+        REQUIRE(page[slot, d] ==
+                2.0f * pool[std::size_t(table[std::size_t(b)]) * 12 +
+                            slot * 3 + d]);
+  });
+  REQUIRE(pages == 2);
+}
+
+// ──────────────────────────────────────────────────────────────────────────────
+// Property: any permutation of pages round-trips through the view
+// ──────────────────────────────────────────────────────────────────────────────
+
+TEST_CASE("paged layout matches a reference block table",
+          "[property][paged]") {
+  rc::prop("paged layout matches a reference block table",
+    [](std::size_t seqs_, std::size_t blocks_, std::size_t page_,
+       std::size_t dim_, std::size_t seed) {
+      std::int64_t const seqs = 1 + std::int64_t(seqs_ % 3);
+      std::int64_t const blocks = 1 + std::int64_t(blocks_ % 4);
+      std::int64_t const page_size = 1 + std::int64_t(page_ % 5);
+      std::int64_t const dim = 1 + std::int64_t(dim_ % 6);
+      std::int64_t const elems = page_size * dim;
+
+      std::vector<std::int32_t> table(std::size_t(seqs * blocks));
+      std::iota(table.begin(), table.end(), 0);
+      std::rotate(table.begin(),
+                  table.begin() + std::ptrdiff_t(seed % table.size()),
+                  table.end());
+      std::reverse(table.begin(), table.end());
+
+      std::vector<int> pool(table.size() * std::size_t(elems), -1);
+      auto kv = make_mdspan(pool.data(),
+                            make_paged_layout(table.data(), seqs, blocks,
+                                              page_size,
+                                              cute::make_shape(dim)));
+      int v = 0;
+      for (std::int64_t s = 0; s < seqs; ++s)
+        for (std::int64_t p = 0; p < blocks * page_size; ++p)
+          for (std::int64_t d = 0; d < dim; ++d)
+            kv[s, p, d] = v++;
+
+      v = 0;
+      for (std::int64_t s = 0; s < seqs; ++s)
+        for (std::int64_t p = 0; p < blocks * page_size; ++p)
+          for (std::int64_t d = 0; d < dim; ++d) {
+            auto const page = table[std::size_t(s * blocks + p / page_size)];
+            auto const off = page * elems + (p % page_size) * dim + d;
+            RC_ASSERT(pool[std::size_t(off)] == v++);
+          }
+      RC_ASSERT(kv.is_unique());
+      RC_ASSERT(kv.mapping().required_span_size() == pool.size());
+    });
+}
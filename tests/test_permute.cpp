@@ -0,0 +1,132 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#include <catch2/catch_all.hpp>
+#include <rapidcheck/catch.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include <cute/layout.hpp>
+#include <cute/swizzle.hpp>
+
+#include <mdspan_cute/permute.h>
+
+using namespace mdspan_cute;
+
+// ──────────────────────────────────────────────────────────────────────────────
+// Plan
+// ──────────────────────────────────────────────────────────────────────────────
+
+TEST_CASE("permute plan tiles the innermost mode of each side",
+          "[permute][order]") {
+  // dst row-major (b = mode 1), src column-major (a = mode 0)
+  auto const plan = detail::make_permute_plan<3>({60, 1, 300}, {1, 12, 5});
+  REQUIRE(plan.b == 1);
+  REQUIRE(plan.a == 0);
+  REQUIRE(plan.outer_count == 1);
+  REQUIRE(plan.outer[0] == 2);
+
+  // Aligned: both innermost on mode 2, tile the next dst mode out
+  auto const aligned = detail::make_permute_plan<3>({20, 4, 1}, {40, 8, 1});
+  REQUIRE(aligned.b == 2);
+  REQUIRE(aligned.a == 1);
+}
+
+// ──────────────────────────────────────────────────────────────────────────────
+// Deterministic copies
+// ──────────────────────────────────────────────────────────────────────────────
+
+TEST_CASE("permute_copy: 2-D transpose across block boundaries",
+          "[permute]") {
+  std::size_t const m = 300, n = 173; // several L2 blocks, ragged tails
+  auto row = cute::make_layout(cute::make_shape(int(m), int(n)),
+                               cute::make_stride(int(n), 1));
+  auto col_t = cute::make_layout(cute::make_shape(int(n), int(m)));
+
+  std::vector<float> a(m * n), t(m * n, -1.0f);
+  auto src = make_mdspan(a.data(), row);
+  for (std::size_t i = 0; i < m; ++i)
+    for (std::size_t j = 0; j < n; ++j)
+      src[i, j] = float(i * n + j);
+
+  auto dst = make_mdspan(t.data(), col_t);
+  permute_copy(src, dst, {1, 0}, std::identity{}, 4);
+  for (std::size_t j = 0; j < n; ++j)
+    for (std::size_t i = 0; i < m; ++i)
+      REQUIRE(dst[j, i] == src[i, j]);
+}
+
+TEST_CASE("permute_copy: swizzled to column-major layout conversion",
+          "[permute][swizzle]") {
+  auto swz = swizzle::make_swizzled_layout<cute::Swizzle<3, 0, 3>>(
+      cute::make_shape(64, 64), cute::make_stride(64, 1));
+  auto col = cute::make_layout(cute::make_shape(64, 64));
+
+  std::vector<int> a(cute::cosize(swz)), b(64 * 64, -1);
+  auto src = make_mdspan(a.data(), swz);
+  for (std::size_t i = 0; i < 64; ++i)
+    for (std::size_t j = 0; j < 64; ++j)
+      src[i, j] = int(i * 64 + j);
+
+  auto dst = make_mdspan(b.data(), col);
+  permute_copy(src, dst);
+  for (std::size_t i = 0; i < 64; ++i)
+    for (std::size_t j = 0; j < 64; ++j)
+      REQUIRE(dst[i, j] == int(i * 64 + j));
+}
+
+TEST_CASE("permute_copy: element op converts on the fly", "[permute]") {
+  auto l = cute::make_layout(cute::make_shape(5, 9));
+  std::vector<int> a(45);
+  std::vector<double> b(45);
+  for (std::size_t i = 0; i < 45; ++i)
+    a[i] = int(i);
+  auto src = make_mdspan(a.data(), l);
+  auto dst = make_mdspan(b.data(), l);
+  permute_copy(src, dst, {0, 1}, [](int v) { return 0.5 * v; });
+  for (std::size_t i = 0; i < 45; ++i)
+    REQUIRE(b[i] == 0.5 * double(i));
+}
+
+// ──────────────────────────────────────────────────────────────────────────────
+// Property: every rank-3 permutation matches the reference
+// ──────────────────────────────────────────────────────────────────────────────
+
+TEST_CASE("permute_copy matches a naive reference", "[property][permute]") {
+  rc::prop("permute_copy matches a naive reference",
+    [](std::size_t a_, std::size_t b_, std::size_t c_, std::size_t p_,
+       std::size_t t_) {
+      std::array<std::size_t, 3> const ext{1 + a_ % 21, 1 + b_ % 21,
+                                           1 + c_ % 21};
+      std::array<std::size_t, 3> perm{0, 1, 2};
+      for (std::size_t r = p_ % 6; r > 0; --r)
+        std::next_permutation(perm.begin(), perm.end());
+      const std::size_t threads = 1 + t_ % 4;
+
+      auto sl = cute::make_layout(
+          cute::make_shape(int(ext[0]), int(ext[1]), int(ext[2])));
+      auto dl = cute::make_layout(
+          cute::make_shape(int(ext[perm[0]]), int(ext[perm[1]]),
+                           int(ext[perm[2]])),
+          cute::make_stride(int(ext[perm[1]] * ext[perm[2]]),
+                            int(ext[perm[2]]), 1));
+
+      std::vector<int> s(ext[0] * ext[1] * ext[2]), d(s.size(), -1);
+      for (std::size_t i = 0; i < s.size(); ++i)
+        s[i] = int(i);
+      auto src = make_mdspan(s.data(), sl);
+      auto dst = make_mdspan(d.data(), dl);
+      permute_copy(src, dst, perm, std::identity{}, threads);
+
+      for (std::size_t i = 0; i < ext[perm[0]]; ++i)
+        for (std::size_t j = 0; j < ext[perm[1]]; ++j)
+          for (std::size_t k = 0; k < ext[perm[2]]; ++k) {
+            std::array<std::size_t, 3> sc{};
+            sc[perm[0]] = i;
+            sc[perm[1]] = j;
+            sc[perm[2]] = k;
+            RC_ASSERT(dst[i, j, k] == src[sc[0], sc[1], sc[2]]);
+          }
+    });
+}
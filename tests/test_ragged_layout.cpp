@@ -0,0 +1,128 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#include <catch2/catch_all.hpp>
+#include <rapidcheck/catch.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <cute/layout.hpp>
+
+#include <mdspan_cute/ragged_layout.h>
+
+using namespace mdspan_cute;
+
+// ──────────────────────────────────────────────────────────────────────────────
+// Element access
+// ──────────────────────────────────────────────────────────────────────────────
+
+TEST_CASE("ragged layout: x[b, t, h] indexes the packed buffer",
+          "[ragged]") {
+  // Lengths 3, 0, 5, 1 packed into 9 tokens of 4 features
+  std::vector<std::int64_t> offsets{0, 3, 3, 8, 9};
+  std::vector<int> packed(9 * 4);
+  for (std::size_t i = 0; i < packed.size(); ++i)
+    packed[i] = int(i);
+
+  auto x = make_mdspan(packed.data(),
+                       make_ragged_layout(offsets.data(), 4,
+                                          cute::make_shape(4)));
+  REQUIRE(x.extent(0) == 4);
+  REQUIRE(x.extent(1) == 5); // longest sequence
+  REQUIRE(x.extent(2) == 4);
+  REQUIRE(sequence_length(x, 1) == 0);
+  REQUIRE(sequence_length(x, 2) == 5);
+
+  REQUIRE(x[0, 2, 3] == 2 * 4 + 3);
+  REQUIRE(x[2, 0, 0] == 3 * 4);
+  REQUIRE(x[2, 4, 1] == 7 * 4 + 1);
+  REQUIRE(x[3, 0, 2] == 8 * 4 + 2);
+}
+
+TEST_CASE("ragged layout: multi-mode features stay row-major", "[ragged]") {
+  std::vector<std::int64_t> offsets{0, 2, 5};
+  std::vector<float> packed(5 * 2 * 3);
+  auto x = make_mdspan(packed.data(),
+                       make_ragged_layout(offsets.data(), 2,
+                                          cute::make_shape(2, 3)));
+  REQUIRE(x.rank() == 4);
+  x[1, 2, 1, 2] = 1.5f; // token 4, feature (1, 2)
+  REQUIRE(packed[4 * 6 + 1 * 3 + 2] == 1.5f);
+}
+
+TEST_CASE("ragged layout: span ends at the last sequence's logical rows",
+          "[ragged]") {
+  // Last sequence is 1 token long but logically max_len = 5: 4 rows of slack
+  std::vector<std::int64_t> offsets{0, 3, 3, 8, 9};
+  std::vector<int> packed(9 * 4 + 4 * 4);
+  auto const m = make_mdspan(packed.data(),
+                             make_ragged_layout(offsets.data(), 4,
+                                                cute::make_shape(4)))
+                     .mapping();
+  REQUIRE(std::size_t(m.required_span_size()) == (8 + 5) * 4);
+  REQUIRE(std::size_t(m.required_span_size()) == std::size_t(m(3, 4, 3)) + 1);
+
+  // Longest sequence last: exactly the packed size
+  std::vector<std::int64_t> tight{0, 2, 5};
+  auto const x = make_mdspan(static_cast<float *>(nullptr),
+                             make_ragged_layout(tight.data(), 2,
+                                                cute::make_shape(2, 3)));
+  REQUIRE(std::size_t(x.mapping().required_span_size()) == 5 * 6);
+}
+
+// ──────────────────────────────────────────────────────────────────────────────
+// Per-sequence dense views
+// ──────────────────────────────────────────────────────────────────────────────
+
+TEST_CASE("ragged_sequences yields dense per-sequence views", "[ragged]") {
+  std::vector<std::int64_t> offsets{0, 3, 3, 8, 9};
+  std::vector<int> packed(9 * 4);
+  for (std::size_t i = 0; i < packed.size(); ++i)
+    packed[i] = int(i);
+  auto x = make_mdspan(packed.data(),
+                       make_ragged_layout(offsets.data(), 4,
+                                          cute::make_shape(4)));
+
+  auto seqs = ragged_sequences(x);
+  REQUIRE(seqs.size() == 4);
+  std::size_t b = 0;
+  for (auto seq : seqs) {
+    REQUIRE(seq.extent(0) == sequence_length(x, b));
+    REQUIRE(seq.extent(1) == 4);
+    for (std::size_t t = 0; t < seq.extent(0); ++t)
+      for (std::size_t h = 0; h < 4; ++h)
+        REQUIRE(seq[t, h] == x[b, t, h]);
+    ++b;
+  }
+  REQUIRE(b == 4);
+  REQUIRE(seqs[2].data_handle() == packed.data() + 3 * 4);
+}
+
+// ──────────────────────────────────────────────────────────────────────────────
+// Property: every valid index lands on its packed position
+// ──────────────────────────────────────────────────────────────────────────────
+
+TEST_CASE("ragged layout matches packed offsets", "[property][ragged]") {
+  rc::prop("ragged layout matches packed offsets",
+    [](std::vector<std::size_t> lens_, std::size_t hidden_) {
+      std::size_t const batch = 1 + lens_.size() % 6;
+      std::size_t const hidden = 1 + hidden_ % 7;
+      std::vector<std::int64_t> offsets{0};
+      for (std::size_t b = 0; b < batch; ++b)
+        offsets.push_back(offsets.back() +
+                          std::int64_t(b < lens_.size() ? lens_[b] % 9 : 0));
+
+      std::vector<int> packed(std::size_t(offsets.back()) * hidden);
+      for (std::size_t i = 0; i < packed.size(); ++i)
+        packed[i] = int(i);
+      auto x = make_mdspan(packed.data(),
+                           make_ragged_layout(offsets.data(),
+                                              std::int64_t(batch),
+                                              cute::make_shape(int(hidden))));
+      for (std::size_t b = 0; b < batch; ++b)
+        for (std::size_t t = 0; t < sequence_length(x, b); ++t)
+          for (std::size_t h = 0; h < hidden; ++h)
+            RC_ASSERT(x[b, t, h] ==
+                      int((std::size_t(offsets[b]) + t) * hidden + h));
+    });
+}
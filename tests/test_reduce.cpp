@@ -0,0 +1,187 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#include <catch2/catch_all.hpp>
+#include <rapidcheck/catch.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+#include <cute/layout.hpp>
+#include <cute/swizzle.hpp>
+
+#include <mdspan_cute/reduce.h>
+
+using namespace mdspan_cute;
+
+namespace {
+
+using vec_view = std::mdspan<int, std::dextents<std::size_t, 1>>;
+using index_view = std::mdspan<std::size_t, std::dextents<std::size_t, 1>>;
+
+} // namespace
+
+// ──────────────────────────────────────────────────────────────────────────────
+// Loop order helpers
+// ──────────────────────────────────────────────────────────────────────────────
+
+TEST_CASE("mode_strides reads exact strides of a column-major layout",
+          "[reduce][order]") {
+  auto cl = cute::make_layout(cute::make_shape(5, 7)); // (5,7):(1,5)
+  std::vector<int> buf(cute::cosize(cl));
+  auto md = make_mdspan(buf.data(), cl);
+
+  REQUIRE(detail::is_affine(md.mapping()));
+  auto const s = mode_strides(md.mapping());
+  REQUIRE(s[0] == 1);
+  REQUIRE(s[1] == 5);
+  auto const order = stride_order(s);
+  REQUIRE(order[0] == 1); // outermost: largest stride
+  REQUIRE(order[1] == 0); // innermost: unit stride
+}
+
+// ──────────────────────────────────────────────────────────────────────────────
+// Deterministic reductions
+// ──────────────────────────────────────────────────────────────────────────────
+
+TEST_CASE("reduce<1>: row sums of a column-major matrix", "[reduce]") {
+  auto cl = cute::make_layout(cute::make_shape(4, 6));
+  std::vector<int> buf(cute::cosize(cl));
+  auto md = make_mdspan(buf.data(), cl);
+  for (std::size_t i = 0; i < 4; ++i)
+    for (std::size_t j = 0; j < 6; ++j)
+      md[i, j] = int(i * 10 + j);
+
+  std::vector<int> out(4, -1);
+  reduce<1>(md, vec_view(out.data(), 4), sum_reducer<int>{});
+
+  for (std::size_t i = 0; i < 4; ++i)
+    REQUIRE(out[i] == int(6 * i * 10 + 15));
+}
+
+TEST_CASE("reduce<0>: column max via binary op", "[reduce]") {
+  auto cl = cute::make_layout(cute::make_shape(4, 6), cute::make_stride(6, 1));
+  std::vector<int> buf(cute::cosize(cl));
+  auto md = make_mdspan(buf.data(), cl);
+  for (std::size_t i = 0; i < 4; ++i)
+    for (std::size_t j = 0; j < 6; ++j)
+      md[i, j] = int((i * 7 + j * 3) % 11);
+
+  std::vector<int> out(6, -1);
+  reduce<0>(md, vec_view(out.data(), 6),
+            [](int a, int b) { return a > b ? a : b; }, 0);
+
+  for (std::size_t j = 0; j < 6; ++j) {
+    int expected = 0;
+    for (std::size_t i = 0; i < 4; ++i)
+      expected = std::max(expected, md[i, j]);
+    REQUIRE(out[j] == expected);
+  }
+}
+
+TEST_CASE("reduce<1>: argmax over a swizzled tile", "[reduce][swizzle]") {
+  // Swizzle<3,0,3>: physical column = column XOR row
+  auto swz = swizzle::make_swizzled_layout<cute::Swizzle<3, 0, 3>>(
+      cute::make_shape(8, 8), cute::make_stride(8, 1));
+  std::vector<int> buf(cute::cosize(swz));
+  auto md = make_mdspan(buf.data(), swz);
+  for (std::size_t i = 0; i < 8; ++i)
+    for (std::size_t j = 0; j < 8; ++j)
+      md[i, j] = (j == (i * 3) % 8 || j == 7) ? 100 : int(j);
+
+  std::vector<std::size_t> out(8);
+  reduce<1>(md, index_view(out.data(), 8), argmax_reducer<int>{});
+
+  // Ties resolve to the smallest position regardless of visit order
+  for (std::size_t i = 0; i < 8; ++i)
+    REQUIRE(out[i] == (i * 3) % 8);
+}
+
+TEST_CASE("reduce<1>: long contiguous runs split across lanes", "[reduce]") {
+  // 37 = 4 full rounds of partial accumulators plus a 5-element tail
+  auto rl = cute::make_layout(cute::make_shape(3, 37),
+                              cute::make_stride(37, 1));
+  std::vector<float> buf(cute::cosize(rl));
+  auto md = make_mdspan(buf.data(), rl);
+  for (std::size_t i = 0; i < 3; ++i)
+    for (std::size_t j = 0; j < 37; ++j)
+      md[i, j] = float((i + 1) * j);
+
+  std::vector<float> sums(3, -1.0f);
+  reduce<1>(md, std::mdspan<float, std::dextents<std::size_t, 1>>(
+                    sums.data(), 3),
+            sum_reducer<float>{});
+  for (std::size_t i = 0; i < 3; ++i)
+    REQUIRE(sums[i] == float((i + 1) * 666));
+
+  // Ties land in different lanes and in the tail; the first one still wins
+  for (std::size_t j : {5u, 10u, 35u})
+    md[1, j] = 1000.0f;
+  std::vector<std::size_t> arg(3);
+  reduce<1>(md, index_view(arg.data(), 3), argmax_reducer<float>{});
+  REQUIRE(arg[0] == 36);
+  REQUIRE(arg[1] == 5);
+  REQUIRE(arg[2] == 36);
+}
+
+TEST_CASE("reduce<0,1>: full reduction into a rank-0 view", "[reduce]") {
+  auto cl = cute::make_layout(cute::make_shape(9, 5));
+  std::vector<int> buf(cute::cosize(cl), 2);
+  auto md = make_mdspan(buf.data(), cl);
+
+  int total = 0;
+  reduce<0, 1>(md, std::mdspan<int, std::extents<std::size_t>>(&total),
+               sum_reducer<int>{}, 4);
+  REQUIRE(total == 90);
+}
+
+TEST_CASE("reduce<0>: large input splits across threads", "[reduce]") {
+  auto cl = cute::make_layout(cute::make_shape(256, 512));
+  std::vector<int> buf(cute::cosize(cl));
+  auto md = make_mdspan(buf.data(), cl);
+  for (std::size_t i = 0; i < 256; ++i)
+    for (std::size_t j = 0; j < 512; ++j)
+      md[i, j] = int(j % 7);
+
+  std::vector<int> out(512, -1);
+  reduce<0>(md, vec_view(out.data(), 512), sum_reducer<int>{}, 4);
+  for (std::size_t j = 0; j < 512; ++j)
+    REQUIRE(out[j] == int(256 * (j % 7)));
+}
+
+// ──────────────────────────────────────────────────────────────────────────────
+// Property: matches a logical-order reference for any thread count
+// ──────────────────────────────────────────────────────────────────────────────
+
+TEST_CASE("reduce matches a naive reference", "[property][reduce]") {
+  rc::prop("reduce matches a naive reference",
+    [](std::size_t a_, std::size_t b_, std::size_t c_, std::size_t t_) {
+      const std::size_t a = std::max<std::size_t>(1, a_ % 9);
+      const std::size_t b = std::max<std::size_t>(1, b_ % 9);
+      const std::size_t c = std::max<std::size_t>(1, c_ % 9);
+      const std::size_t threads = 1 + t_ % 4;
+      auto cl = cute::make_layout(
+          cute::make_shape(int(a), int(b), int(c)),
+          cute::make_stride(int(b), 1, int(a * b))); // permuted strides
+      std::vector<int> buf(cute::cosize(cl));
+      auto md = make_mdspan(buf.data(), cl);
+      for (std::size_t i = 0; i < a; ++i)
+        for (std::size_t j = 0; j < b; ++j)
+          for (std::size_t k = 0; k < c; ++k)
+            md[i, j, k] = int(i * 31 + j * 17 + k * 5) % 13;
+
+      std::vector<int> out(a * c, -1);
+      reduce<1>(md,
+                std::mdspan<int, std::dextents<std::size_t, 2>>(out.data(), a,
+                                                                c),
+                sum_reducer<int>{}, threads);
+
+      for (std::size_t i = 0; i < a; ++i)
+        for (std::size_t k = 0; k < c; ++k) {
+          int expected = 0;
+          for (std::size_t j = 0; j < b; ++j)
+            expected += md[i, j, k];
+          RC_ASSERT(out[i * c + k] == expected);
+        }
+    });
+}
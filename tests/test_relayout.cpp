@@ -0,0 +1,146 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#include <catch2/catch_all.hpp>
+#include <rapidcheck/catch.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include <cute/layout.hpp>
+#include <cute/swizzle.hpp>
+
+#include <mdspan_cute/relayout.h>
+
+using namespace mdspan_cute;
+
+namespace {
+
+// Logical value planted at (i, j) before the relayout
+constexpr int tag(std::size_t i, std::size_t j) { return int(i * 1000 + j); }
+
+} // namespace
+
+// ──────────────────────────────────────────────────────────────────────────────
+// Deterministic relayouts
+// ──────────────────────────────────────────────────────────────────────────────
+
+TEST_CASE("relayout_in_place: row-major to swizzled", "[relayout][swizzle]") {
+  using namespace cute;
+  auto row = make_layout(make_shape(Int<16>{}, Int<16>{}),
+                         make_stride(Int<16>{}, Int<1>{}));
+  auto swz = swizzle::make_swizzled_layout<Swizzle<3, 0, 3>>(
+      make_shape(Int<16>{}, Int<16>{}), make_stride(Int<16>{}, Int<1>{}));
+
+  std::vector<int> buf(256);
+  auto src = make_mdspan(buf.data(), row);
+  for (std::size_t i = 0; i < 16; ++i)
+    for (std::size_t j = 0; j < 16; ++j)
+      src[i, j] = tag(i, j);
+
+  auto const dst = relayout_in_place(src, swz, 4);
+  REQUIRE(dst.has_value());
+  REQUIRE(dst->data_handle() == buf.data());
+  for (std::size_t i = 0; i < 16; ++i)
+    for (std::size_t j = 0; j < 16; ++j) {
+      REQUIRE((*dst)[i, j] == tag(i, j));
+      REQUIRE(buf[swz(i, j)] == tag(i, j));
+    }
+}
+
+TEST_CASE("relayout_in_place: column-major to row-major",
+          "[relayout]") {
+  auto col = cute::make_layout(cute::make_shape(6, 10));
+  auto row = cute::make_layout(cute::make_shape(6, 10),
+                               cute::make_stride(10, 1));
+  std::vector<int> buf(60);
+  auto src = make_mdspan(buf.data(), col);
+  for (std::size_t i = 0; i < 6; ++i)
+    for (std::size_t j = 0; j < 10; ++j)
+      src[i, j] = tag(i, j);
+
+  auto const dst = relayout_in_place(src, row);
+  REQUIRE(dst.has_value());
+  for (std::size_t i = 0; i < 6; ++i)
+    for (std::size_t j = 0; j < 10; ++j)
+      REQUIRE(buf[i * 10 + j] == tag(i, j));
+  REQUIRE((*dst)[5, 9] == tag(5, 9));
+}
+
+TEST_CASE("relayout_in_place: dynamic swizzle source inverts the target",
+          "[relayout][swizzle]") {
+  auto swz = swizzle::make_swizzled_layout<cute::Swizzle<2, 0, 3>>(
+      cute::make_shape(8, 8), cute::make_stride(8, 1));
+  auto col = cute::make_layout(cute::make_shape(8, 8));
+  std::vector<int> buf(64);
+  auto src = make_mdspan(buf.data(), swz);
+  for (std::size_t i = 0; i < 8; ++i)
+    for (std::size_t j = 0; j < 8; ++j)
+      src[i, j] = tag(i, j);
+
+  auto const dst = relayout_in_place(src, col, 3);
+  REQUIRE(dst.has_value());
+  for (std::size_t i = 0; i < 8; ++i)
+    for (std::size_t j = 0; j < 8; ++j) {
+      REQUIRE((*dst)[i, j] == tag(i, j));
+      REQUIRE(buf[i + 8 * j] == tag(i, j));
+    }
+}
+
+TEST_CASE("relayout_in_place: rejects a pair with no closed-form inverse",
+          "[relayout][swizzle]") {
+  using namespace cute;
+  // 40 elements: not a multiple of either swizzle's 32-element period, so
+  // neither side has a storage inverse (both are still bijections)
+  auto shape = make_shape(Int<8>{}, Int<5>{});
+  auto from = swizzle::make_swizzled_layout<Swizzle<2, 0, 3>>(
+      shape, make_stride(Int<5>{}, Int<1>{}));
+  auto to = swizzle::make_swizzled_layout<Swizzle<1, 0, 4>>(
+      shape, make_stride(Int<5>{}, Int<1>{}));
+
+  std::vector<int> buf(40);
+  auto src = make_mdspan(buf.data(), from);
+  for (std::size_t i = 0; i < 8; ++i)
+    for (std::size_t j = 0; j < 5; ++j)
+      src[i, j] = tag(i, j);
+  auto const before = buf;
+
+  REQUIRE_FALSE(relayout_in_place(src, to, 2).has_value());
+  REQUIRE(buf == before);
+}
+
+// ──────────────────────────────────────────────────────────────────────────────
+// Property: any pair of compact stride permutations round-trips
+// ──────────────────────────────────────────────────────────────────────────────
+
+TEST_CASE("relayout_in_place preserves every element",
+          "[property][relayout]") {
+  rc::prop("relayout_in_place preserves every element",
+    [](std::size_t a_, std::size_t b_, std::size_t c_, std::size_t t_) {
+      const std::size_t a = 1 + a_ % 9;
+      const std::size_t b = 1 + b_ % 9;
+      const std::size_t c = 1 + c_ % 9;
+      const std::size_t threads = 1 + t_ % 4;
+      auto shape = cute::make_shape(int(a), int(b), int(c));
+      auto from = cute::make_layout(
+          shape, cute::make_stride(int(b), 1, int(a * b)));
+      auto to = cute::make_layout(
+          shape, cute::make_stride(int(b * c), int(c), 1));
+
+      std::vector<int> buf(a * b * c);
+      auto src = make_mdspan(buf.data(), from);
+      for (std::size_t i = 0; i < a; ++i)
+        for (std::size_t j = 0; j < b; ++j)
+          for (std::size_t k = 0; k < c; ++k)
+            src[i, j, k] = int((i * b + j) * c + k);
+
+      auto const dst = relayout_in_place(src, to, threads);
+      RC_ASSERT(dst.has_value());
+      for (std::size_t i = 0; i < a; ++i)
+        for (std::size_t j = 0; j < b; ++j)
+          for (std::size_t k = 0; k < c; ++k)
+            RC_ASSERT((*dst)[i, j, k] == int((i * b + j) * c + k));
+      // Row-major target: storage is now the identity sequence
+      for (std::size_t p = 0; p < buf.size(); ++p)
+        RC_ASSERT(buf[p] == int(p));
+    });
+}
@@ -0,0 +1,126 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#include <catch2/catch_all.hpp>
+#include <rapidcheck/catch.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <type_traits>
+#include <vector>
+
+#include <cute/layout.hpp>
+
+#include <mdspan_cute/ring_layout.h>
+
+using namespace mdspan_cute;
+
+// ──────────────────────────────────────────────────────────────────────────────
+// Wrap selection
+// ──────────────────────────────────────────────────────────────────────────────
+
+TEST_CASE("ring layout: mask only for static power-of-two totals", "[ring]") {
+  auto row = cute::make_shape(cute::Int<4>{});
+  auto s = make_ring_layout(cute::Int<8>{}, row);
+  auto d = make_ring_layout(8, cute::make_shape(4));
+  auto odd = make_ring_layout(cute::Int<6>{}, row);
+  auto uses_mask = [](auto const &l) {
+    return std::remove_cvref_t<decltype(l.layout_a())>::uses_mask;
+  };
+  REQUIRE(uses_mask(s));
+  REQUIRE(!uses_mask(d));
+  REQUIRE(!uses_mask(odd));
+  REQUIRE(int(cute::cosize(s)) == 32);
+  REQUIRE(int(cute::cosize(odd)) == 24);
+}
+
+// ──────────────────────────────────────────────────────────────────────────────
+// Advancing and segments
+// ──────────────────────────────────────────────────────────────────────────────
+
+TEST_CASE("ring layout: advancing moves the head, not the data", "[ring]") {
+  std::vector<int> buf(4 * 3, 0);
+  auto ring = make_mdspan(buf.data(), make_ring_layout(4, cute::make_shape(3)));
+  REQUIRE(ring.is_unique()); // ring_fn vouches for itself
+  for (std::size_t t = 0; t < 4; ++t)
+    for (std::size_t f = 0; f < 3; ++f)
+      ring[t, f] = int(10 * t + f);
+  REQUIRE(buf[5] == 12);
+
+  ring = advance_ring(ring, 1);
+  REQUIRE(ring[0, 0] == 10); // old row 1 is now the oldest
+  REQUIRE(ring[2, 2] == 32);
+  for (std::size_t f = 0; f < 3; ++f)
+    ring[3, f] = int(40 + f); // lands in physical row 0
+  REQUIRE(buf[0] == 40);
+  REQUIRE(buf[2] == 42);
+
+  // Logical rows [1, 4) wrap: physical rows 2, 3 then 0
+  auto const runs = ring_spans(ring, 1, 3);
+  REQUIRE(runs[0].data() == buf.data() + 6);
+  REQUIRE(runs[0].size() == 6);
+  REQUIRE(runs[1].data() == buf.data());
+  REQUIRE(runs[1].size() == 3);
+
+  // Rows [0, 2) do not wrap
+  auto const one = ring_spans(ring, 0, 2);
+  REQUIRE(one[0].size() == 6);
+  REQUIRE(one[1].empty());
+
+  // Moving back restores the original view
+  auto back = advance_ring(ring, -1);
+  REQUIRE(back[0, 0] == 40);
+  REQUIRE(back[1, 0] == 10);
+}
+
+TEST_CASE("ring layout: static power-of-two ring wraps by mask", "[ring]") {
+  std::vector<float> buf(8 * 2);
+  auto ring = make_mdspan(buf.data(),
+                          make_ring_layout(cute::Int<8>{},
+                                           cute::make_shape(cute::Int<2>{})));
+  ring = advance_ring(ring, 13); // 13 mod 8 = 5 rows
+  ring[0, 1] = 1.0f;
+  ring[3, 0] = 2.0f;
+  REQUIRE(buf[5 * 2 + 1] == 1.0f);
+  REQUIRE(buf[0] == 2.0f);
+}
+
+// ──────────────────────────────────────────────────────────────────────────────
+// Property: a ring of pushes matches a bounded deque
+// ──────────────────────────────────────────────────────────────────────────────
+
+TEST_CASE("ring layout matches a bounded deque", "[property][ring]") {
+  rc::prop("ring layout matches a bounded deque",
+    [](std::size_t cap_, std::size_t width_, std::size_t pushes_) {
+      std::size_t const cap = 1 + cap_ % 9, width = 1 + width_ % 4;
+      std::size_t const pushes = pushes_ % 40;
+
+      std::vector<int> buf(cap * width, -1);
+      auto ring = make_mdspan(buf.data(),
+                              make_ring_layout(int(cap),
+                                               cute::make_shape(int(width))));
+      std::deque<std::vector<int>> ref(cap, std::vector<int>(width, -1));
+
+      for (std::size_t k = 0; k < pushes; ++k) {
+        ring = advance_ring(ring, 1);
+        ref.pop_front();
+        ref.emplace_back(width);
+        for (std::size_t f = 0; f < width; ++f) {
+          ring[cap - 1, f] = int(k * width + f);
+          ref.back()[f] = int(k * width + f);
+        }
+      }
+
+      for (std::size_t t = 0; t < cap; ++t)
+        for (std::size_t f = 0; f < width; ++f)
+          RC_ASSERT(ring[t, f] == ref[t][f]);
+
+      // The two runs concatenate to the logical contents
+      std::vector<int> flat;
+      for (auto run : ring_spans(ring))
+        flat.insert(flat.end(), run.begin(), run.end());
+      RC_ASSERT(flat.size() == cap * width);
+      for (std::size_t t = 0; t < cap; ++t)
+        for (std::size_t f = 0; f < width; ++f)
+          RC_ASSERT(flat[t * width + f] == ref[t][f]);
+    });
+}
@@ -0,0 +1,78 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#include <catch2/catch_all.hpp>
+
+#include <cstddef>
+#include <vector>
+
+#include <cute/layout.hpp>
+#include <cute/swizzle.hpp>
+
+#include <mdspan_cute/static_loop.h>
+
+using namespace mdspan_cute;
+
+// ──────────────────────────────────────────────────────────────────────────────
+// Visit order is ascending physical offset, computed at compile time
+// ──────────────────────────────────────────────────────────────────────────────
+
+TEST_CASE("static_visit_table orders a column-major tile by offset",
+          "[static]") {
+  using CL = decltype(cute::make_layout(
+      cute::make_shape(cute::Int<4>{}, cute::Int<2>{})));
+  using MD = cute_mdspan<int, CL>;
+  using E = typename MD::extents_type;
+
+  constexpr auto table = static_visit_table<CL, E>();
+  static_assert(table.size() == 8);
+  static_assert(table[0].offset == 0);
+  static_assert(table[1].coord[0] == 1 && table[1].coord[1] == 0);
+  static_assert(table[4].coord[0] == 0 && table[4].coord[1] == 1);
+  static_assert(table[7].offset == 7);
+  SUCCEED();
+}
+
+TEST_CASE("static_for_each visits every element in offset order",
+          "[static]") {
+  using CL = decltype(cute::make_layout(
+      cute::make_shape(cute::Int<8>{}, cute::Int<8>{}),
+      cute::make_stride(cute::Int<8>{}, cute::Int<1>{})));
+  std::vector<int> buf(cute::cosize(CL{}), 0);
+  cute_mdspan<int, CL> md(buf.data());
+
+  std::vector<std::size_t> offsets;
+  static_for_each(md, [&](auto const &c, int &x) {
+    x = int(c[0] * 10 + c[1]);
+    offsets.push_back(static_cast<std::size_t>(&x - buf.data()));
+  });
+
+  REQUIRE(offsets.size() == 64);
+  for (std::size_t i = 0; i < offsets.size(); ++i)
+    REQUIRE(offsets[i] == i);
+  for (std::size_t i = 0; i < 8; ++i)
+    for (std::size_t j = 0; j < 8; ++j)
+      REQUIRE(md[i, j] == int(i * 10 + j));
+}
+
+TEST_CASE("static_for_each follows a static swizzle", "[static][swizzle]") {
+  using CL = decltype(swizzle::make_swizzled_layout<cute::Swizzle<2, 0, 3>>(
+      cute::make_shape(cute::Int<8>{}, cute::Int<4>{}),
+      cute::make_stride(cute::Int<4>{}, cute::Int<1>{})));
+  static_assert(cute_static_layout<CL>);
+
+  std::vector<int> buf(cute::cosize(CL{}), -1);
+  cute_mdspan<int, CL> md(buf.data());
+
+  std::size_t prev = 0, visits = 0;
+  static_for_each(md, [&](auto const &c, int &x) {
+    auto const off = static_cast<std::size_t>(&x - buf.data());
+    if (visits++ > 0)
+      REQUIRE(off > prev);
+    prev = off;
+    x = int(c[0] * 4 + c[1]);
+  });
+
+  REQUIRE(visits == 32);
+  for (std::size_t i = 0; i < 8; ++i)
+    for (std::size_t j = 0; j < 4; ++j)
+      REQUIRE(md[i, j] == int(i * 4 + j));
+}
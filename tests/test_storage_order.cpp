@@ -0,0 +1,136 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#include <catch2/catch_all.hpp>
+#include <rapidcheck/catch.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include <cute/layout.hpp>
+#include <cute/swizzle.hpp>
+
+#include <mdspan_cute/storage_order.h>
+
+using namespace mdspan_cute;
+
+namespace {
+
+// Walks md in storage order; returns the visit count when offsets never
+// decrease, every coordinate is visited once and each element is the one
+// operator[] resolves to (0 otherwise)
+template <class MDSpan> auto check_storage_walk(MDSpan md) -> std::size_t {
+  std::vector<int> seen(md.size(), 0);
+  std::ptrdiff_t last = -1;
+  bool monotone = true, matches = true;
+  std::size_t visits = 0;
+  auto const exts = detail::extents_array(md.extents());
+
+  for_each_in_storage_order(md, [&](auto const &c, auto &x) {
+    auto const off = &x - md.data_handle();
+    monotone = monotone && off >= last;
+    last = off;
+    matches = matches && &x == &detail::element_at(md, c);
+    ++seen[detail::flatten_colex(c, exts)];
+    ++visits;
+  });
+
+  bool const once =
+      std::all_of(seen.begin(), seen.end(), [](int n) { return n == 1; });
+  return monotone && matches && once ? visits : 0;
+}
+
+} // namespace
+
+// ──────────────────────────────────────────────────────────────────────────────
+// Strategy selection
+// ──────────────────────────────────────────────────────────────────────────────
+
+TEST_CASE("storage walk: static compact layouts invert through right_inverse",
+          "[storage_order]") {
+  using namespace cute;
+  auto col = make_layout(make_shape(Int<4>{}, Int<6>{}));
+  auto row = make_layout(make_shape(Int<4>{}, Int<6>{}),
+                         make_stride(Int<6>{}, Int<1>{}));
+  std::vector<float> buf(24);
+
+  auto mc = make_mdspan(buf.data(), col);
+  auto mr = make_mdspan(buf.data(), row);
+  REQUIRE(storage_walk_for(mc.mapping()) == storage_walk::inverse);
+  REQUIRE(storage_walk_for(mr.mapping()) == storage_walk::inverse);
+  REQUIRE(check_storage_walk(mc) == 24);
+  REQUIRE(check_storage_walk(mr) == 24);
+}
+
+TEST_CASE("storage walk: swizzled tile streams offsets 0..n-1",
+          "[storage_order][swizzle]") {
+  using namespace cute;
+  auto swz = swizzle::make_swizzled_layout<Swizzle<3, 0, 3>>(
+      make_shape(Int<8>{}, Int<8>{}), make_stride(Int<8>{}, Int<1>{}));
+  std::vector<int> buf(cute::cosize(swz));
+  auto md = make_mdspan(buf.data(), swz);
+
+  REQUIRE(storage_walk_for(md.mapping()) == storage_walk::inverse);
+
+  std::size_t expected = 0;
+  bool sequential = true;
+  for_each_in_storage_order(md, [&](auto const &, int &x) {
+    sequential = sequential &&
+                 std::size_t(&x - buf.data()) == expected++;
+  });
+  REQUIRE(sequential);
+  REQUIRE(check_storage_walk(md) == 64);
+}
+
+TEST_CASE("storage walk: negative swizzle shifts use the full period",
+          "[storage_order][swizzle]") {
+  using namespace cute;
+  // Swizzle<2,3,-3> XORs bits [3,5) into bits [6,8): period 2^8 elements
+  auto full = swizzle::make_swizzled_layout<Swizzle<2, 3, -3>>(
+      make_shape(Int<16>{}, Int<16>{}), make_stride(Int<16>{}, Int<1>{}));
+  auto half = swizzle::make_swizzled_layout<Swizzle<2, 3, -3>>(
+      make_shape(Int<8>{}, Int<16>{}), make_stride(Int<16>{}, Int<1>{}));
+  REQUIRE(detail::storage_inverse(full).has_value());
+  // 128 elements: the swizzle sets bit 7 and leaves [0, 128)
+  REQUIRE_FALSE(detail::storage_inverse(half).has_value());
+}
+
+TEST_CASE("storage walk: padded transpose uses the stride-ordered nest",
+          "[storage_order]") {
+  auto cl = cute::make_layout(cute::make_shape(5, 7),
+                              cute::make_stride(1, 8)); // padded columns
+  std::vector<int> buf(cute::cosize(cl));
+  auto md = make_mdspan(buf.data(), cl);
+  REQUIRE(storage_walk_for(md.mapping()) == storage_walk::nested);
+  REQUIRE(check_storage_walk(md) == 35);
+}
+
+TEST_CASE("storage walk: broadcast falls back to the sorted table",
+          "[storage_order]") {
+  auto cl = cute::make_layout(cute::make_shape(4, 3),
+                              cute::make_stride(0, 1)); // rows alias
+  std::vector<int> buf(cute::cosize(cl));
+  auto md = make_mdspan(buf.data(), cl);
+  REQUIRE(storage_walk_for(md.mapping()) == storage_walk::sorted);
+  REQUIRE(check_storage_walk(md) == 12);
+}
+
+// ──────────────────────────────────────────────────────────────────────────────
+// Property: any permuted-stride layout walks monotonically
+// ──────────────────────────────────────────────────────────────────────────────
+
+TEST_CASE("storage walk is monotone for permuted strides",
+          "[property][storage_order]") {
+  rc::prop("storage walk is monotone for permuted strides",
+    [](std::size_t a_, std::size_t b_, std::size_t c_, std::size_t p_) {
+      const std::size_t a = std::max<std::size_t>(1, a_ % 7);
+      const std::size_t b = std::max<std::size_t>(1, b_ % 7);
+      const std::size_t c = std::max<std::size_t>(1, c_ % 7);
+      const std::size_t pad = p_ % 3;
+      auto cl = cute::make_layout(
+          cute::make_shape(int(a), int(b), int(c)),
+          cute::make_stride(int(b + pad), 1, int(a * (b + pad))));
+      std::vector<int> buf(cute::cosize(cl));
+      auto md = make_mdspan(buf.data(), cl);
+      RC_ASSERT(check_storage_walk(md) == a * b * c);
+    });
+}
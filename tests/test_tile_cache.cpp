@@ -0,0 +1,268 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#include <catch2/catch_all.hpp>
+#include <rapidcheck/catch.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <cute/layout.hpp>
+#include <cute/swizzle.hpp>
+
+#include <mdspan_cute/packing.h>
+#include <mdspan_cute/tile_cache.h>
+
+using namespace mdspan_cute;
+
+namespace {
+
+using matrix = std::mdspan<float const, std::dextents<std::size_t, 2>>;
+
+auto const tiler = cute::make_shape(cute::Int<16>{}, cute::Int<16>{});
+
+// 16 × 16 float tile: 1 KiB, one block
+auto plain_tile() {
+  return cute::make_layout(cute::make_shape(cute::Int<16>{}, cute::Int<16>{}),
+                           cute::LayoutRight{});
+}
+
+auto swizzled_tile() {
+  return swizzle::make_swizzled_layout<swizzle::sw32>(
+      cute::make_shape(cute::Int<16>{}, cute::Int<16>{}),
+      cute::LayoutRight{});
+}
+
+auto iota_matrix(std::size_t rows, std::size_t cols) -> std::vector<float> {
+  std::vector<float> x(rows * cols);
+  for (std::size_t i = 0; i < x.size(); ++i)
+    x[i] = float(i);
+  return x;
+}
+
+} // namespace
+
+// ──────────────────────────────────────────────────────────────────────────────
+// Hits, misses and relayout
+// ──────────────────────────────────────────────────────────────────────────────
+
+TEST_CASE("tile_cache relayouts on a miss and hits afterwards",
+          "[tile_cache]") {
+  auto const x = iota_matrix(40, 40); // 3 × 3 tiles, edge tiles 8 wide
+  matrix const src(x.data(), 40, 40);
+  tile_cache cache(1 << 20);
+
+  auto const *first = [&] {
+    auto h = cache.get(src, tiler, {0, 1}, swizzled_tile());
+    for (std::size_t r = 0; r < 16; ++r)
+      for (std::size_t c = 0; c < 16; ++c)
+        REQUIRE(h.view()[r, c] == src[r, 16 + c]);
+    return h.data();
+  }();
+  auto const again = cache.get(src, tiler, {0, 1}, swizzled_tile());
+  REQUIRE(again.data() == first);
+
+  auto const s = cache.stats();
+  REQUIRE(s.misses == 1);
+  REQUIRE(s.hits == 1);
+  REQUIRE(s.entries == 1);
+  REQUIRE(s.resident_bytes == 1024);
+  REQUIRE(s.hit_rate() == 0.5);
+}
+
+TEST_CASE("tile_cache zero-pads clipped edge tiles", "[tile_cache]") {
+  auto const x = iota_matrix(40, 40);
+  matrix const src(x.data(), 40, 40);
+  tile_cache cache(1 << 20);
+
+  auto const h = cache.get(src, tiler, {2, 2}, swizzled_tile());
+  for (std::size_t r = 0; r < 16; ++r)
+    for (std::size_t c = 0; c < 16; ++c)
+      REQUIRE(h.view()[r, c] ==
+              (r < 8 && c < 8 ? src[32 + r, 32 + c] : 0.0f));
+}
+
+TEST_CASE("tile_cache keys on target layout and element type",
+          "[tile_cache]") {
+  auto const x = iota_matrix(32, 32);
+  matrix const src(x.data(), 32, 32);
+  tile_cache cache(1 << 20);
+
+  (void)cache.get(src, tiler, {1, 0}, plain_tile());
+  (void)cache.get(src, tiler, {1, 0}, swizzled_tile());
+  auto const d = cache.get<double>(src, tiler, {1, 0}, plain_tile());
+  REQUIRE(d.view()[3, 4] == double(src[19, 4]));
+  // Same tile number under another tiling is another entry
+  (void)cache.get(src, cute::make_shape(cute::Int<8>{}, cute::Int<32>{}),
+                  {1, 0}, cute::make_layout(cute::make_shape(
+                              cute::Int<8>{}, cute::Int<32>{})));
+  REQUIRE(cache.stats().misses == 4);
+  REQUIRE(cache.stats().hits == 0);
+  (void)cache.get(src, tiler, {1, 0}, swizzled_tile());
+  REQUIRE(cache.stats().hits == 1);
+}
+
+TEST_CASE("tile_cache stages fp32 into swizzled bf16 tiles", "[tile_cache]") {
+  auto const x = iota_matrix(32, 32);
+  matrix const src(x.data(), 32, 32);
+  tile_cache cache(1 << 20);
+
+  auto const h = cache.get<bf16_t>(src, tiler, {1, 1}, swizzled_tile());
+  for (std::size_t r = 0; r < 16; ++r)
+    for (std::size_t c = 0; c < 16; ++c)
+      REQUIRE(h.view()[r, c] == bf16_t(src[16 + r, 16 + c]));
+  REQUIRE(cache.stats().resident_bytes == 512);
+  REQUIRE(cache.get<bf16_t>(src, tiler, {1, 1}, swizzled_tile()).data() ==
+          h.data());
+}
+
+TEST_CASE("tile_cache get_or_fill runs a custom packer once",
+          "[tile_cache]") {
+  std::vector<std::int8_t> x(10 * 6);
+  for (std::size_t i = 0; i < x.size(); ++i)
+    x[i] = std::int8_t(i);
+  std::mdspan<std::int8_t const, std::dextents<std::size_t, 2>> b(x.data(),
+                                                                   10, 6);
+  auto const vnni = packing::make_vnni_layout<4>(10, 6);
+  tile_cache cache(1 << 20);
+
+  int fills = 0;
+  auto pack = [&](auto dst) {
+    ++fills;
+    (void)pack_vnni<4>(b, dst.data_handle(), 1);
+  };
+  for (int rep = 0; rep < 3; ++rep) {
+    auto const h = cache.get_or_fill<std::int8_t>(x.data(), 0, vnni, pack);
+    REQUIRE(h.view()[1, 2, 5] == b[9, 5]);
+    REQUIRE(h.view()[3, 2, 5] == 0); // row 11 is padding
+  }
+  REQUIRE(fills == 1);
+}
+
+TEST_CASE("tile_cache forgets a tile whose fill throws", "[tile_cache]") {
+  tile_cache cache(1 << 20);
+  float const key = 0.0f;
+  auto const fail = [](auto) { throw std::runtime_error("fill"); };
+  REQUIRE_THROWS_AS(cache.get_or_fill<float>(&key, 0, plain_tile(), fail),
+                    std::runtime_error);
+  REQUIRE(cache.stats().entries == 0);
+  REQUIRE(cache.stats().resident_bytes == 0);
+
+  auto const h = cache.get_or_fill<float>(&key, 0, plain_tile(), [](auto d) {
+    d[0, 0] = 7.0f;
+  });
+  REQUIRE(h.view()[0, 0] == 7.0f);
+}
+
+// ──────────────────────────────────────────────────────────────────────────────
+// Eviction
+// ──────────────────────────────────────────────────────────────────────────────
+
+TEST_CASE("tile_cache evicts least recently used tiles over budget",
+          "[tile_cache]") {
+  auto const x = iota_matrix(64, 64);
+  matrix const src(x.data(), 64, 64);
+  tile_cache cache(3 * 1024); // three 1 KiB tiles
+
+  auto touch = [&](std::size_t j) {
+    return cache.get(src, tiler, {0, j}, plain_tile()).data();
+  };
+  auto const *a = touch(0);
+  (void)touch(1);
+  (void)touch(2);
+  REQUIRE(touch(0) == a); // a is now most recent; b is oldest
+  (void)touch(3);         // evicts b
+  auto s = cache.stats();
+  REQUIRE(s.evictions == 1);
+  REQUIRE(s.entries == 3);
+  REQUIRE(s.resident_bytes == 3 * 1024);
+
+  (void)touch(1); // miss again; evicts c
+  (void)touch(0); // still cached
+  s = cache.stats();
+  REQUIRE(s.misses == 5);
+  REQUIRE(s.hits == 2);
+  REQUIRE(s.evictions == 2);
+}
+
+TEST_CASE("tile_cache never evicts pinned tiles", "[tile_cache]") {
+  auto const x = iota_matrix(64, 64);
+  matrix const src(x.data(), 64, 64);
+  tile_cache cache(1024); // one tile
+
+  {
+    auto const held = cache.get(src, tiler, {1, 1}, plain_tile());
+    (void)cache.get(src, tiler, {1, 2}, plain_tile());
+    REQUIRE(cache.stats().resident_bytes == 2 * 1024);
+    REQUIRE(cache.stats().evictions == 0);
+    REQUIRE(held.view()[0, 0] == src[16, 16]);
+  }
+  (void)cache.get(src, tiler, {1, 3}, plain_tile());
+  REQUIRE(cache.stats().evictions == 2);
+  REQUIRE(cache.stats().resident_bytes == 1024);
+
+  cache.clear();
+  REQUIRE(cache.stats().entries == 0);
+  REQUIRE(cache.stats().arena_bytes == 0);
+}
+
+// ──────────────────────────────────────────────────────────────────────────────
+// Concurrency
+// ──────────────────────────────────────────────────────────────────────────────
+
+TEST_CASE("tile_cache repacks each tile once across threads",
+          "[tile_cache]") {
+  auto const x = iota_matrix(48, 48); // 3 × 3 tiles
+  matrix const src(x.data(), 48, 48);
+  tile_cache cache(1 << 20);
+  std::atomic<int> mismatches{0};
+
+  std::vector<std::thread> pool;
+  for (std::size_t w = 0; w < 8; ++w)
+    pool.emplace_back([&, w] {
+      for (std::size_t rep = 0; rep < 4; ++rep)
+        for (std::size_t t = 0; t < 9; ++t) {
+          std::size_t const i = (t + w) % 9 / 3, j = (t + w) % 3;
+          auto const h = cache.get(src, tiler, {i, j}, swizzled_tile());
+          if (h.view()[5, 7] != src[16 * i + 5, 16 * j + 7])
+            ++mismatches;
+        }
+    });
+  for (auto &t : pool)
+    t.join();
+
+  REQUIRE(mismatches == 0);
+  auto const s = cache.stats();
+  REQUIRE(s.misses == 9);
+  REQUIRE(s.hits == 8 * 4 * 9 - 9);
+}
+
+// ──────────────────────────────────────────────────────────────────────────────
+// Properties
+// ──────────────────────────────────────────────────────────────────────────────
+
+TEST_CASE("cached tiles match the source", "[property][tile_cache]") {
+  rc::prop("cached tiles match the source", [] {
+    auto const rows = *rc::gen::inRange<std::size_t>(1, 50);
+    auto const cols = *rc::gen::inRange<std::size_t>(1, 50);
+    auto const x = iota_matrix(rows, cols);
+    matrix const src(x.data(), rows, cols);
+    auto const ti = *rc::gen::inRange<std::size_t>(0, (rows + 15) / 16);
+    auto const tj = *rc::gen::inRange<std::size_t>(0, (cols + 15) / 16);
+    auto const budget = *rc::gen::inRange<std::size_t>(0, 4096);
+    tile_cache cache(budget);
+
+    for (int rep = 0; rep < 2; ++rep) {
+      auto const h = cache.get(src, tiler, {ti, tj}, swizzled_tile());
+      for (std::size_t r = 0; r < 16; ++r)
+        for (std::size_t c = 0; c < 16; ++c) {
+          std::size_t const i = 16 * ti + r, j = 16 * tj + c;
+          RC_ASSERT(h.view()[r, c] ==
+                    (i < rows && j < cols ? src[i, j] : 0.0f));
+        }
+    }
+    RC_ASSERT(cache.stats().misses == 1u);
+  });
+}
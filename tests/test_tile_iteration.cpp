@@ -0,0 +1,96 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#include <catch2/catch_all.hpp>
+#include <rapidcheck/catch.h>
+
+#include <cstddef>
+#include <vector>
+
+#include <cute/layout.hpp>
+#include <cute/swizzle.hpp>
+
+#include <mdspan_cute/tile_iteration.h>
+
+using namespace mdspan_cute;
+
+// ──────────────────────────────────────────────────────────────────────────────
+// Interior / remainder partition
+// ──────────────────────────────────────────────────────────────────────────────
+
+TEST_CASE("tile_split: 10x7 by 4x4 peels two interior tiles", "[tile]") {
+  auto cl = cute::make_layout(cute::make_shape(10, 7));
+  std::vector<int> buf(cute::cosize(cl), 0);
+  auto md = make_mdspan(buf.data(), cl);
+
+  auto tiler = cute::make_shape(cute::Int<4>{}, cute::Int<4>{});
+  tile_split split(md.extents(), tiler);
+
+  REQUIRE(split.tile_counts()[0] == 3);
+  REQUIRE(split.tile_counts()[1] == 2);
+  REQUIRE(split.full_tile_counts()[0] == 2);
+  REQUIRE(split.full_tile_counts()[1] == 1);
+  REQUIRE_FALSE(split.is_divisible());
+
+  auto const s = split.stats();
+  REQUIRE(s.interior_tiles == 2);
+  REQUIRE(s.remainder_tiles == 4);
+  REQUIRE(s.remainder_elements == 70 - 32);
+  REQUIRE(s.holes == 6 * 16 - 70);
+}
+
+TEST_CASE("for_each_tiled visits every element exactly once", "[tile]") {
+  auto cl = cute::make_layout(cute::make_shape(10, 7));
+  std::vector<int> buf(cute::cosize(cl), 0);
+  auto md = make_mdspan(buf.data(), cl);
+
+  auto stats = for_each_tiled(md, cute::make_shape(cute::Int<4>{}, 3),
+                              [](auto const &, int &x) { ++x; });
+
+  for (int v : buf)
+    REQUIRE(v == 1);
+  REQUIRE(stats.interior_tiles == 2 * 2);
+  REQUIRE(stats.holes == 3 * 3 * 12 - 70);
+}
+
+TEST_CASE("for_each_tiled on a divisible swizzled tile has no remainder",
+          "[tile][swizzle]") {
+  auto swz = swizzle::make_swizzled_layout<swizzle::sw32>(
+      cute::make_shape(cute::Int<8>{}, cute::Int<8>{}),
+      cute::make_stride(cute::Int<8>{}, cute::Int<1>{}));
+  std::vector<int> buf(cute::cosize(swz), -1);
+  auto md = make_mdspan(buf.data(), swz);
+
+  auto stats = for_each_tiled(
+      md, cute::make_shape(cute::Int<4>{}, cute::Int<4>{}),
+      [](auto const &c, int &x) { x = int(c[0] * 8 + c[1]); });
+
+  REQUIRE(stats.remainder_tiles == 0);
+  REQUIRE(stats.holes == 0);
+  for (std::size_t i = 0; i < 8; ++i)
+    for (std::size_t j = 0; j < 8; ++j)
+      REQUIRE(md[i, j] == int(i * 8 + j));
+}
+
+// ──────────────────────────────────────────────────────────────────────────────
+// Property: hole count matches Split::num_holes per mode
+// ──────────────────────────────────────────────────────────────────────────────
+
+TEST_CASE("tile_split holes agree with the split model", "[property][tile]") {
+  rc::prop("tile_split holes agree with the split model",
+    [](std::size_t n_, std::size_t t_) {
+      const std::size_t n = std::max<std::size_t>(1, n_ % 128);
+      const std::size_t t = std::max<std::size_t>(1, t_ % 17);
+      auto cl = cute::make_layout(cute::make_shape(static_cast<int>(n)));
+      std::vector<int> buf(cute::cosize(cl), 0);
+      auto md = make_mdspan(buf.data(), cl);
+
+      auto stats = for_each_tiled(md, cute::make_shape(static_cast<int>(t)),
+                                  [](auto const &, int &x) { ++x; });
+
+      std::size_t const outer = (n + t - 1) / t;
+      RC_ASSERT(stats.holes == outer * t - n);
+      RC_ASSERT(stats.interior_tiles == n / t);
+      RC_ASSERT(stats.remainder_tiles == (n % t == 0 ? 0u : 1u));
+      for (int v : buf)
+        RC_ASSERT(v == 1);
+    });
+}
@@ -0,0 +1,105 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#include <catch2/catch_all.hpp>
+#include <rapidcheck/catch.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+#include <cute/layout.hpp>
+
+#include <mdspan_cute/tile_scheduler.h>
+
+using namespace mdspan_cute;
+
+// ──────────────────────────────────────────────────────────────────────────────
+// Plan
+// ──────────────────────────────────────────────────────────────────────────────
+
+TEST_CASE("tile plan: partial last wave is split evenly across workers",
+          "[scheduler][stream_k]") {
+  // 10x7 by 4x4: 3x2 = 6 tiles; on 4 workers the last 2 tiles are the tail
+  std::dextents<std::size_t, 2> const exts(10, 7);
+  tile_split const split(exts,
+                         cute::make_shape(cute::Int<4>{}, cute::Int<4>{}));
+  auto const [queues, tail] = detail::plan_tile_work(split, 4, true);
+
+  REQUIRE(tail == 2);
+  REQUIRE(queues.size() == 4);
+  std::size_t whole = 0, pieces = 0;
+  for (auto const &q : queues) {
+    REQUIRE(!q.empty());
+    for (auto const &w : q) {
+      (w.partial ? pieces : whole) += 1;
+      if (w.partial)
+        REQUIRE(w.end[0] - w.begin[0] == 1); // one of the 4 tail rows
+    }
+  }
+  REQUIRE(whole == 4);
+  REQUIRE(pieces == 4);
+}
+
+TEST_CASE("tile plan: stream-K off keeps whole tiles", "[scheduler]") {
+  std::dextents<std::size_t, 2> const exts(10, 7);
+  tile_split const split(exts, cute::make_shape(4, 4));
+  auto const [queues, tail] = detail::plan_tile_work(split, 4, false);
+  REQUIRE(tail == 0);
+  std::size_t n = 0;
+  for (auto const &q : queues)
+    n += q.size();
+  REQUIRE(n == 6);
+}
+
+// ──────────────────────────────────────────────────────────────────────────────
+// Execution
+// ──────────────────────────────────────────────────────────────────────────────
+
+TEST_CASE("schedule_tiles: every element runs once, counters add up",
+          "[scheduler]") {
+  auto cl = cute::make_layout(cute::make_shape(37, 53));
+  std::vector<int> buf(cute::cosize(cl), 0);
+  auto md = make_mdspan(buf.data(), cl);
+
+  auto const stats = schedule_tiles(
+      md, cute::make_shape(cute::Int<8>{}, cute::Int<8>{}),
+      [&](auto const &work) {
+        for_each_in_work(md, work, [](auto const &, int &x) { ++x; });
+      },
+      {.num_threads = 3});
+
+  REQUIRE(std::all_of(buf.begin(), buf.end(), [](int v) { return v == 1; }));
+  REQUIRE(stats.tiles == 5 * 7);
+  REQUIRE(stats.stream_k_tiles == 35 % 3);
+  REQUIRE(stats.workers.size() == 3);
+  std::size_t tasks = 0;
+  for (auto const &w : stats.workers)
+    tasks += w.tasks;
+  REQUIRE(tasks == stats.tasks);
+}
+
+TEST_CASE("schedule_tiles covers ragged extents exactly once",
+          "[property][scheduler]") {
+  rc::prop("schedule_tiles covers ragged extents exactly once",
+    [](std::size_t a_, std::size_t b_, std::size_t ta_, std::size_t tb_,
+       std::size_t w_, bool stream_k) {
+      const std::size_t a = 1 + a_ % 40, b = 1 + b_ % 40;
+      const std::size_t ta = 1 + ta_ % 9, tb = 1 + tb_ % 9;
+      const std::size_t workers = 1 + w_ % 5;
+      auto cl = cute::make_layout(cute::make_shape(int(a), int(b)));
+      std::vector<std::atomic<int>> hits(a * b);
+      auto md = make_mdspan(hits.data(), cl);
+
+      schedule_tiles(
+          md, cute::make_shape(int(ta), int(tb)),
+          [&](auto const &work) {
+            for_each_in_work(md, work, [](auto const &, std::atomic<int> &h) {
+              h.fetch_add(1);
+            });
+          },
+          {.num_threads = workers, .stream_k = stream_k});
+
+      for (auto const &h : hits)
+        RC_ASSERT(h.load() == 1);
+    });
+}
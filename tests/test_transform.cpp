@@ -0,0 +1,191 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#include <catch2/catch_all.hpp>
+#include <rapidcheck/catch.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include <cute/layout.hpp>
+#include <cute/swizzle.hpp>
+
+#include <mdspan_cute/transform.h>
+
+using namespace mdspan_cute;
+
+// ──────────────────────────────────────────────────────────────────────────────
+// Loop plan
+// ──────────────────────────────────────────────────────────────────────────────
+
+TEST_CASE("elementwise plan coalesces modes contiguous in all operands",
+          "[transform][order]") {
+  auto row = cute::make_layout(cute::make_shape(4, 6), cute::make_stride(6, 1));
+  auto col = cute::make_layout(cute::make_shape(4, 6)); // (4,6):(1,4)
+  std::vector<float> a(24), b(24);
+  auto ra = make_mdspan(a.data(), row);
+  auto rb = make_mdspan(b.data(), row);
+  auto cb = make_mdspan(b.data(), col);
+
+  std::array<std::size_t, 2> const ext{4, 6};
+
+  auto const same = detail::make_elementwise_plan(ext, ra.mapping(),
+                                                  rb.mapping());
+  REQUIRE(same.affine);
+  REQUIRE(same.run_modes == 2);
+  REQUIRE(same.run_len == 24);
+  REQUIRE_FALSE(same.blocked);
+
+  // Transposed operand: no common contiguous run, mode 1 still innermost
+  // because its summed stride (1 + 4) beats mode 0 (6 + 1)
+  auto const mixed = detail::make_elementwise_plan(ext, ra.mapping(),
+                                                   cb.mapping());
+  REQUIRE(mixed.run_modes == 1);
+  REQUIRE(mixed.order[1] == 1);
+  // ... so it is tiled: b innermost in the output, a innermost in the input
+  REQUIRE(mixed.blocked);
+  REQUIRE(mixed.tiles.b == 1);
+  REQUIRE(mixed.tiles.a == 0);
+
+  // A broadcast (stride 0) mode is not a reason to block
+  auto bc = cute::make_layout(cute::make_shape(4, 6), cute::make_stride(0, 1));
+  auto const broadcast = detail::make_elementwise_plan(
+      ext, ra.mapping(), make_mdspan(b.data(), bc).mapping());
+  REQUIRE_FALSE(broadcast.blocked);
+}
+
+// ──────────────────────────────────────────────────────────────────────────────
+// Deterministic transforms
+// ──────────────────────────────────────────────────────────────────────────────
+
+TEST_CASE("transform: fused axpy over row-major operands", "[transform]") {
+  auto cl = cute::make_layout(cute::make_shape(8, 16), cute::make_stride(16, 1));
+  std::vector<float> x(128), y(128), out(128, -1.0f);
+  for (std::size_t i = 0; i < 128; ++i) {
+    x[i] = float(i);
+    y[i] = float(2 * i);
+  }
+  transform(make_mdspan(out.data(), cl),
+            [](float xv, float yv) { return 3.0f * xv + yv; },
+            make_mdspan(x.data(), cl), make_mdspan(y.data(), cl));
+
+  for (std::size_t i = 0; i < 128; ++i)
+    REQUIRE(out[i] == 5.0f * float(i));
+}
+
+TEST_CASE("transform: transposed input into row-major output",
+          "[transform]") {
+  auto row = cute::make_layout(cute::make_shape(5, 7), cute::make_stride(7, 1));
+  auto col = cute::make_layout(cute::make_shape(5, 7));
+  std::vector<int> src(35), dst(35, -1);
+  auto in = make_mdspan(src.data(), col);
+  for (std::size_t i = 0; i < 5; ++i)
+    for (std::size_t j = 0; j < 7; ++j)
+      in[i, j] = int(i * 100 + j);
+
+  auto out = make_mdspan(dst.data(), row);
+  transform(out, [](int v) { return v + 1; }, in);
+
+  for (std::size_t i = 0; i < 5; ++i)
+    for (std::size_t j = 0; j < 7; ++j)
+      REQUIRE(out[i, j] == int(i * 100 + j + 1));
+}
+
+TEST_CASE("transform: blocked transpose spans several L2 blocks",
+          "[transform]") {
+  // (3, 300, 200): mode 0 outer, modes 1 and 2 tiled with clipped edges
+  auto row = cute::make_layout(cute::make_shape(3, 300, 200),
+                               cute::make_stride(60000, 200, 1));
+  auto tr = cute::make_layout(cute::make_shape(3, 300, 200),
+                              cute::make_stride(60000, 1, 300));
+  std::vector<int> src(60000 * 3), dst(60000 * 3, -1);
+  auto in = make_mdspan(src.data(), tr);
+  for (std::size_t k = 0; k < 3; ++k)
+    for (std::size_t i = 0; i < 300; ++i)
+      for (std::size_t j = 0; j < 200; ++j)
+        in[k, i, j] = int(k * 100000 + i * 1000 + j);
+
+  auto out = make_mdspan(dst.data(), row);
+  std::array<std::size_t, 3> const ext{3, 300, 200};
+  REQUIRE(detail::make_elementwise_plan(ext, out.mapping(), in.mapping())
+              .blocked);
+  transform(4, out, [](int v) { return -v; }, in);
+  for (std::size_t k = 0; k < 3; ++k)
+    for (std::size_t i = 0; i < 300; ++i)
+      for (std::size_t j = 0; j < 200; ++j)
+        REQUIRE(dst[k * 60000 + i * 200 + j] ==
+                -int(k * 100000 + i * 1000 + j));
+}
+
+TEST_CASE("transform: swizzled and broadcast operands", "[transform][swizzle]") {
+  auto swz = swizzle::make_swizzled_layout<cute::Swizzle<3, 0, 3>>(
+      cute::make_shape(8, 8), cute::make_stride(8, 1));
+  auto bias_l = cute::make_layout(cute::make_shape(8, 8),
+                                  cute::make_stride(0, 1)); // row broadcast
+  auto row = cute::make_layout(cute::make_shape(8, 8), cute::make_stride(8, 1));
+
+  std::vector<int> a(cute::cosize(swz)), bias(8), dst(64, -1);
+  auto in = make_mdspan(a.data(), swz);
+  for (std::size_t i = 0; i < 8; ++i)
+    for (std::size_t j = 0; j < 8; ++j)
+      in[i, j] = int(i * 8 + j);
+  for (std::size_t j = 0; j < 8; ++j)
+    bias[j] = int(1000 * j);
+
+  auto out = make_mdspan(dst.data(), row);
+  transform(out, [](int v, int b) { return v + b; }, in,
+            make_mdspan(bias.data(), bias_l));
+
+  for (std::size_t i = 0; i < 8; ++i)
+    for (std::size_t j = 0; j < 8; ++j)
+      REQUIRE(out[i, j] == int(i * 8 + j + 1000 * j));
+}
+
+TEST_CASE("transform: large input splits across threads", "[transform]") {
+  auto cl = cute::make_layout(cute::make_shape(256, 300));
+  std::vector<int> src(cute::cosize(cl)), dst(cute::cosize(cl), -1);
+  for (std::size_t i = 0; i < src.size(); ++i)
+    src[i] = int(i % 97);
+  transform(4, make_mdspan(dst.data(), cl), [](int v) { return 2 * v; },
+            make_mdspan(src.data(), cl));
+  for (std::size_t i = 0; i < dst.size(); ++i)
+    REQUIRE(dst[i] == 2 * int(i % 97));
+}
+
+// ──────────────────────────────────────────────────────────────────────────────
+// Property: matches a logical-order reference for any layout mix
+// ──────────────────────────────────────────────────────────────────────────────
+
+TEST_CASE("transform matches a naive reference", "[property][transform]") {
+  rc::prop("transform matches a naive reference",
+    [](std::size_t a_, std::size_t b_, std::size_t c_, std::size_t t_) {
+      const std::size_t a = std::max<std::size_t>(1, a_ % 9);
+      const std::size_t b = std::max<std::size_t>(1, b_ % 9);
+      const std::size_t c = std::max<std::size_t>(1, c_ % 9);
+      const std::size_t threads = 1 + t_ % 4;
+      auto shape = cute::make_shape(int(a), int(b), int(c));
+      auto l0 = cute::make_layout(shape); // column-major
+      auto l1 = cute::make_layout(
+          shape, cute::make_stride(int(b * c), int(c), 1)); // row-major
+      auto l2 = cute::make_layout(
+          shape, cute::make_stride(int(b), 1, int(a * b))); // permuted
+
+      std::vector<int> x(a * b * c), y(a * b * c), z(a * b * c, -1);
+      auto mx = make_mdspan(x.data(), l1);
+      auto my = make_mdspan(y.data(), l2);
+      for (std::size_t i = 0; i < a; ++i)
+        for (std::size_t j = 0; j < b; ++j)
+          for (std::size_t k = 0; k < c; ++k) {
+            mx[i, j, k] = int(i * 31 + j * 17 + k * 5);
+            my[i, j, k] = int(i + j + k);
+          }
+
+      auto mz = make_mdspan(z.data(), l0);
+      transform(threads, mz, [](int u, int v) { return u - v; }, mx, my);
+
+      for (std::size_t i = 0; i < a; ++i)
+        for (std::size_t j = 0; j < b; ++j)
+          for (std::size_t k = 0; k < c; ++k)
+            RC_ASSERT(mz[i, j, k] == mx[i, j, k] - my[i, j, k]);
+    });
+}
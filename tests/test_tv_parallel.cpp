@@ -0,0 +1,192 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#include <catch2/catch_all.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+#include <cute/layout.hpp>
+
+#include <mdspan_cute/tv_parallel.h>
+
+using namespace mdspan_cute;
+
+namespace {
+
+// cute's SM80 16x8 accumulator layout: (thread, value) → m + 16·n
+using sm80_16x8_c = cute::Layout<
+    cute::Shape<cute::Shape<cute::_4, cute::_8>,
+                cute::Shape<cute::_2, cute::_2>>,
+    cute::Stride<cute::Stride<cute::_32, cute::_1>,
+                 cute::Stride<cute::_16, cute::_8>>>;
+
+auto const mma_tile = cute::make_shape(cute::_16{}, cute::_8{});
+
+} // namespace
+
+// ──────────────────────────────────────────────────────────────────────────────
+// TV layouts
+// ──────────────────────────────────────────────────────────────────────────────
+
+TEST_CASE("parallel_for: sm80 16x8 TV layout covers the tile once",
+          "[tv_parallel][mma]") {
+  auto cl = cute::make_layout(cute::make_shape(16, 8));
+  std::vector<int> buf(128, 0);
+  auto md = make_mdspan(buf.data(), cl);
+
+  std::vector<std::atomic<int>> hits(128);
+  parallel_for(sm80_16x8_c{}, mma_tile, 4, md, [&](auto const &c, int &x) {
+    x = int(c[0] * 100 + c[1]);
+    hits[c[0] + 16 * c[1]].fetch_add(1);
+  });
+
+  for (auto const &h : hits)
+    REQUIRE(h.load() == 1);
+  for (std::size_t i = 0; i < 16; ++i)
+    for (std::size_t j = 0; j < 8; ++j)
+      REQUIRE(md[i, j] == int(i * 100 + j));
+}
+
+TEST_CASE("parallel_for: TV tile repeats over a larger tensor",
+          "[tv_parallel]") {
+  auto cl = cute::make_layout(cute::make_shape(16, 32)); // 4 tiles of 16x8
+  std::vector<int> buf(cute::cosize(cl), 0);
+  auto md = make_mdspan(buf.data(), cl);
+
+  parallel_for(sm80_16x8_c{}, mma_tile, 32, md,
+               [](auto const &, int &x) { ++x; }, /*pin=*/false);
+  for (int v : buf)
+    REQUIRE(v == 1);
+}
+
+TEST_CASE("parallel_for: each tile sees the TV layout in its own (m, n)",
+          "[tv_parallel][mma]") {
+  // 32 × 16: extent(0) is twice the tile's M, so tiles stack along m too
+  auto cl = cute::make_layout(cute::make_shape(32, 16));
+  std::vector<int> buf(cute::cosize(cl), 0);
+  auto md = make_mdspan(buf.data(), cl);
+
+  // One worker per TV thread; record which worker wrote each element
+  std::vector<std::thread::id> owner(32 * 16);
+  parallel_for(sm80_16x8_c{}, mma_tile, 32, md,
+               [&](auto const &c, int &x) {
+                 ++x;
+                 owner[c[0] + 32 * c[1]] = std::this_thread::get_id();
+               },
+               /*pin=*/false);
+  for (int v : buf)
+    REQUIRE(v == 1);
+
+  sm80_16x8_c const tv{};
+  for (int t = 0; t < 32; ++t)
+    for (int v = 0; v < 4; ++v) {
+      int const idx = tv(t, v), m = idx % 16, n = idx / 16;
+      auto const id = owner[m + 32 * n];
+      REQUIRE(owner[(m + 16) + 32 * n] == id);
+      REQUIRE(owner[m + 32 * (n + 8)] == id);
+      REQUIRE(owner[(m + 16) + 32 * (n + 8)] == id);
+      // Same thread as value 0 of thread t in the first tile
+      int const idx0 = tv(t, 0);
+      REQUIRE(owner[idx0 % 16 + 32 * (idx0 / 16)] == id);
+    }
+}
+
+// ──────────────────────────────────────────────────────────────────────────────
+// local_partition
+// ──────────────────────────────────────────────────────────────────────────────
+
+TEST_CASE("local_partition: thread tile selects congruent coordinates",
+          "[tv_parallel][partition]") {
+  auto cl = cute::make_layout(cute::make_shape(8, 8));
+  std::vector<int> buf(64);
+  auto md = make_mdspan(buf.data(), cl);
+  for (std::size_t i = 0; i < 8; ++i)
+    for (std::size_t j = 0; j < 8; ++j)
+      md[i, j] = int(i * 8 + j);
+
+  // Thread layout 2x4, column-major: thread 5 sits at (1, 2)
+  auto thr = cute::make_layout(cute::make_shape(2, 4));
+  auto part = local_partition(md, thr, 5);
+  REQUIRE(part.extent(0) == 4);
+  REQUIRE(part.extent(1) == 2);
+  for (std::size_t i = 0; i < 4; ++i)
+    for (std::size_t j = 0; j < 2; ++j)
+      REQUIRE(part[i, j] == int((i * 2 + 1) * 8 + (j * 4 + 2)));
+}
+
+TEST_CASE("local_partition: partitions are disjoint and cover the tensor",
+          "[tv_parallel][partition]") {
+  auto cl = cute::make_layout(cute::make_shape(8, 12),
+                              cute::make_stride(12, 1));
+  std::vector<int> buf(96);
+  auto md = make_mdspan(buf.data(), cl);
+  auto thr = cute::make_layout(cute::make_shape(2, 4));
+
+  std::vector<int> owner(96, -1);
+  for (std::size_t t = 0; t < 8; ++t) {
+    auto part = local_partition(md, thr, t);
+    REQUIRE(part.size() == 12);
+    for_each_index(part.extents(), [&](auto const &c) {
+      auto const p = &detail::element_at(part, c) - buf.data();
+      REQUIRE(p >= 0);
+      REQUIRE(p < 96);
+      REQUIRE(owner[p] == -1); // no element in two partitions
+      owner[p] = int(t);
+    });
+  }
+  for (int o : owner)
+    REQUIRE(o != -1);
+}
+
+TEST_CASE("parallel_for_partition: workers cover the tensor once",
+          "[tv_parallel][partition]") {
+  auto cl = cute::make_layout(cute::make_shape(12, 8),
+                              cute::make_stride(8, 1));
+  std::vector<int> buf(96, -1);
+  auto md = make_mdspan(buf.data(), cl);
+
+  std::vector<std::atomic<int>> hits(96);
+  parallel_for_partition(cute::make_layout(cute::make_shape(3, 2)), md,
+                         [&](auto const &c, int &x) {
+                           x = int(c[0] * 8 + c[1]);
+                           hits[c[0] * 8 + c[1]].fetch_add(1);
+                         });
+  for (std::size_t p = 0; p < 96; ++p) {
+    REQUIRE(hits[p].load() == 1);
+    REQUIRE(buf[p] == int(p));
+  }
+}
+
+TEST_CASE("parallel_for_partition: hierarchical thread layouts report "
+          "md's coordinates",
+          "[tv_parallel][partition]") {
+  // md is ((2, 4), 8): coordinates (i, j, k) at offset i + 2j + 8k. The
+  // thread mode (2, 2) splits (2, 4) so that thread (a, b) owns j = b + 2l,
+  // which a per-flat-mode rebuild (local · 2 + b) gets wrong
+  auto cl = cute::make_layout(
+      cute::make_shape(cute::make_shape(2, 4), 8));
+  auto thr = cute::make_layout(
+      cute::make_shape(cute::make_shape(2, 2), 2));
+  std::vector<int> buf(64, -1);
+  auto md = make_mdspan(buf.data(), cl);
+  REQUIRE(md.rank() == 3);
+
+  std::vector<std::atomic<int>> hits(64);
+  std::atomic<int> mismatches{0};
+  parallel_for_partition(
+      thr, md,
+      [&](auto const &c, int &x) {
+        auto const p = std::size_t(c[0] + 2 * c[1] + 8 * c[2]);
+        if (&x != buf.data() + p)
+          ++mismatches;
+        x = int(p);
+        hits[p].fetch_add(1);
+      },
+      false);
+  REQUIRE(mismatches == 0);
+  for (std::size_t p = 0; p < 64; ++p) {
+    REQUIRE(hits[p].load() == 1);
+    REQUIRE(buf[p] == int(p));
+  }
+}
@@ -0,0 +1,142 @@
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#include <catch2/catch_all.hpp>
+#include <rapidcheck/catch.h>
+
+#include <array>
+#include <cstddef>
+
+#include <cute/layout.hpp>
+#include <cute/swizzle.hpp>
+
+#include <mdspan_cute/vector_access.h>
+
+using namespace mdspan_cute;
+
+namespace {
+
+using row8x16 = decltype(cute::make_layout(
+    cute::make_shape(cute::Int<8>{}, cute::Int<16>{}), cute::LayoutRight{}));
+using col8x16 = decltype(cute::make_layout(
+    cute::make_shape(cute::Int<8>{}, cute::Int<16>{})));
+using sw_row8x16 = decltype(swizzle::make_swizzled_layout<
+                            cute::Swizzle<1, 2, 3>>(
+    cute::make_shape(cute::Int<8>{}, cute::Int<16>{}), cute::LayoutRight{}));
+using odd_row = decltype(cute::make_layout(
+    cute::make_shape(cute::Int<3>{}, cute::Int<6>{}), cute::LayoutRight{}));
+
+} // namespace
+
+// ──────────────────────────────────────────────────────────────────────────────
+// Static analysis
+// ──────────────────────────────────────────────────────────────────────────────
+
+TEST_CASE("vectorizable_v follows strides and swizzle blocks", "[vector]") {
+  STATIC_REQUIRE(vectorizable_v<row8x16, 16>);
+  STATIC_REQUIRE(vectorizable_v<col8x16, 8>);
+  STATIC_REQUIRE(!vectorizable_v<col8x16, 16>); // column has 8 rows
+  STATIC_REQUIRE(!vectorizable_v<row8x16, 3>);  // not a power of two
+  // Swizzle<1, 2, 3> leaves 4-element blocks intact
+  STATIC_REQUIRE(vectorizable_v<sw_row8x16, 4>);
+  STATIC_REQUIRE(!vectorizable_v<sw_row8x16, 8>);
+  // Row stride 6 breaks 4-alignment of row starts; 2 still works
+  STATIC_REQUIRE(!vectorizable_v<odd_row, 4>);
+  STATIC_REQUIRE(vectorizable_v<odd_row, 2>);
+}
+
+// ──────────────────────────────────────────────────────────────────────────────
+// Loads and stores
+// ──────────────────────────────────────────────────────────────────────────────
+
+TEST_CASE("load_vec and store_vec move whole runs", "[vector]") {
+  alignas(64) std::array<float, 128> buf{};
+  auto t = make_mdspan(buf.data(), col8x16{});
+  for (std::size_t j = 0; j < 16; ++j)
+    for (std::size_t i = 0; i < 8; ++i)
+      t[i, j] = float(i * 100 + j);
+
+  auto v = load_vec<4>(t, std::array{4, 3});
+  for (int l = 0; l < 4; ++l)
+    REQUIRE(v[l] == float((4 + l) * 100 + 3));
+
+  store_vec<4>(t, std::array{0, 5}, v + 1.0f);
+  for (std::size_t l = 0; l < 4; ++l)
+    REQUIRE(t[l, 5] == float((4 + l) * 100 + 3 + 1));
+  REQUIRE(t[4, 5] == float(4 * 100 + 5));
+}
+
+// ──────────────────────────────────────────────────────────────────────────────
+// Property: swizzled vector loads match scalar loads
+// ──────────────────────────────────────────────────────────────────────────────
+
+TEST_CASE("swizzled load_vec matches scalar access", "[property][vector]") {
+  rc::prop("swizzled load_vec matches scalar access",
+    [](std::size_t i_, std::size_t j_) {
+      alignas(64) std::array<int, 128> buf{};
+      auto t = make_mdspan(buf.data(), sw_row8x16{});
+      for (std::size_t i = 0; i < 8; ++i)
+        for (std::size_t j = 0; j < 16; ++j)
+          t[i, j] = int(i * 16 + j);
+
+      std::size_t const i = i_ % 8, j = (j_ % 4) * 4;
+      auto v = load_vec<4>(t, std::array{i, j});
+      for (std::size_t l = 0; l < 4; ++l)
+        RC_ASSERT(v[int(l)] == t[i, j + l]);
+
+      store_vec<4>(t, std::array{i, j}, v * 2);
+      for (std::size_t l = 0; l < 4; ++l)
+        RC_ASSERT(t[i, j + l] == int(2 * (i * 16 + j + l)));
+    });
+}
+
+// ──────────────────────────────────────────────────────────────────────────────
+// Shuffled access: constant in-register permutations
+// ──────────────────────────────────────────────────────────────────────────────
+
+namespace {
+
+using col4x4 = decltype(cute::make_layout(
+    cute::make_shape(cute::Int<4>{}, cute::Int<4>{})));
+using xor4x4 = decltype(swizzle::make_swizzled_layout<cute::Swizzle<2, 0, 2>>(
+    cute::make_shape(cute::Int<4>{}, cute::Int<4>{}), cute::LayoutRight{}));
+
+} // namespace
+
+TEST_CASE("shufflable_v needs one permutation per aligned group",
+          "[vector][shuffle]") {
+  STATIC_REQUIRE(shufflable_v<col4x4, 16>);
+  STATIC_REQUIRE(!shufflable_v<col4x4, 4>); // a row spans four blocks
+  STATIC_REQUIRE(shufflable_v<xor4x4, 16>);
+  STATIC_REQUIRE(!shufflable_v<xor4x4, 4>); // each row permuted differently
+  STATIC_REQUIRE(shufflable_v<row8x16, 8>); // identity
+}
+
+TEST_CASE("load_shuffled reads a column-major tile in row-major order",
+          "[vector][shuffle]") {
+  alignas(64) std::array<float, 16> buf{};
+  auto t = make_mdspan(buf.data(), col4x4{});
+  for (std::size_t i = 0; i < 4; ++i)
+    for (std::size_t j = 0; j < 4; ++j)
+      t[i, j] = float(10 * i + j);
+
+  auto rows = load_shuffled<16>(t, std::array{0, 0});
+  for (int i = 0; i < 4; ++i)
+    for (int j = 0; j < 4; ++j)
+      REQUIRE(rows[4 * i + j] == float(10 * i + j));
+
+  // store_shuffled applies the inverse permutation
+  store_shuffled<16>(t, std::array{0, 0}, rows + 1.0f);
+  for (std::size_t i = 0; i < 4; ++i)
+    for (std::size_t j = 0; j < 4; ++j)
+      REQUIRE(t[i, j] == float(10 * i + j + 1));
+}
+
+TEST_CASE("load_shuffled undoes an xor swizzle", "[vector][shuffle]") {
+  alignas(64) std::array<int, 16> buf{};
+  auto t = make_mdspan(buf.data(), xor4x4{});
+  for (std::size_t i = 0; i < 4; ++i)
+    for (std::size_t j = 0; j < 4; ++j)
+      t[i, j] = int(4 * i + j);
+  auto v = load_shuffled<16>(t, std::array{0, 0});
+  for (int l = 0; l < 16; ++l)
+    REQUIRE(v[l] == l);
+}